@@ -0,0 +1,37 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <BigIrreducibleFraction.h>
+#include <OperationContext.h>
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+// асинхронные версии долгих операций над BigInt и BigIrreducibleFraction
+// каждая операция запускается в отдельном потоке (std::async), поэтому не ждет очереди общего пула и не занимает его потоки ожиданием;
+// context (необязательный) позволяет отменить операцию, задать срок и получать прогресс, тогда future вернет OperationCancelledException
+// как и у std::async, деструктор future дожидается операции, поэтому перед отказом от результата операцию стоит отменить
+class BIGINT_API AsyncOperations {
+public:
+	static std::future<BigInt> Multiply(const BigInt& multiplier1, const BigInt& multiplier2, const std::shared_ptr<OperationContext>& context = nullptr);
+	// целочисленное деление (divisor != 0)
+	static std::future<BigInt> Divide(const BigInt& dividend, const BigInt& divisor, const std::shared_ptr<OperationContext>& context = nullptr);
+	static std::future<BigInt> GetGreatestCommonDivisor(const BigInt& num1, const BigInt& num2, const std::shared_ptr<OperationContext>& context = nullptr);
+	static std::future<BigInt> GetPower(const BigInt& base, const unsigned long long& exponent, const std::shared_ptr<OperationContext>& context = nullptr);
+	// несократимая дробь numerator/denominator (denominator != 0)
+	static std::future<BigIrreducibleFraction> Reduce(const BigInt& numerator, const BigInt& denominator, const std::shared_ptr<OperationContext>& context = nullptr);
+private:
+	// запуск function в отдельном потоке с привязанным контекстом
+	template <typename Function>
+	static std::future<decltype(std::declval<Function>()())> Run(Function function, const std::shared_ptr<OperationContext>& context);
+};
+
+template <typename Function>
+std::future<decltype(std::declval<Function>()())> AsyncOperations::Run(Function function, const std::shared_ptr<OperationContext>& context) {
+	return std::async(std::launch::async, [function, context]() {
+		OperationScope scope(context.get(), true);
+		// операция, отмененная до запуска, не начинается
+		OperationContext::Checkpoint();
+		return function();
+	});
+}
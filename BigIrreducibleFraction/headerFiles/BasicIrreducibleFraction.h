@@ -0,0 +1,194 @@
+#pragma once
+
+#include <BigIrreducibleFraction.h>
+#include <FixedBigInt.h>
+#include <iostream>
+#include <stdexcept>
+
+// несократимая дробь над целым типом Integer (BigInt или FixedBigInt<Bits>)
+// Integer должен поддерживать + - * / %, сравнения, конструктор из long long и статический GetGreatestCommonDivisor
+// операции сокращают множители заранее (через НОД знаменателей и перекрестные НОД), поэтому промежуточные значения
+// не больше, чем нужно для результата, и дроби фиксированной ширины переполняются как можно позже
+// с FixedBigInt дробь не выделяет память; при переполнении операции бросают FixedBigIntOverflowException,
+// а GetWithPromotion повторяет вычисление над BigIrreducibleFraction
+template <typename Integer>
+class BasicIrreducibleFraction {
+	public:
+		BasicIrreducibleFraction();
+		BasicIrreducibleFraction(const Integer& numerator, const Integer& denominator = Integer(1));
+		// дробь из заведомо несократимых числителя и знаменателя (знаменатель > 0), без подсчета НОД
+		static BasicIrreducibleFraction CreateFromReduced(const Integer& numerator, const Integer& denominator);
+		friend BasicIrreducibleFraction operator+(const BasicIrreducibleFraction& summand1, const BasicIrreducibleFraction& summand2) {
+			return BasicIrreducibleFraction::GetSum(summand1, summand2.numerator, summand2.denominator);
+		}
+		friend BasicIrreducibleFraction operator-(const BasicIrreducibleFraction& minuend, const BasicIrreducibleFraction& subtrahend) {
+			return BasicIrreducibleFraction::GetSum(minuend, -subtrahend.numerator, subtrahend.denominator);
+		}
+		friend BasicIrreducibleFraction operator*(const BasicIrreducibleFraction& multiplier1, const BasicIrreducibleFraction& multiplier2) {
+			return BasicIrreducibleFraction::GetProduct(multiplier1, multiplier2.numerator, multiplier2.denominator);
+		}
+		friend BasicIrreducibleFraction operator/(const BasicIrreducibleFraction& dividend, const BasicIrreducibleFraction& divisor) {
+			if (divisor.numerator == 0)
+				throw std::domain_error("BasicIrreducibleFraction: division by zero");
+			// деление на c/d - умножение на d/c со знаком, перенесенным в числитель
+			if (divisor.numerator < 0)
+				return BasicIrreducibleFraction::GetProduct(dividend, -divisor.denominator, -divisor.numerator);
+			return BasicIrreducibleFraction::GetProduct(dividend, divisor.denominator, divisor.numerator);
+		}
+		BasicIrreducibleFraction& operator+=(const BasicIrreducibleFraction& summand);
+		BasicIrreducibleFraction& operator-=(const BasicIrreducibleFraction& subtrahend);
+		BasicIrreducibleFraction& operator*=(const BasicIrreducibleFraction& multiplier);
+		BasicIrreducibleFraction& operator/=(const BasicIrreducibleFraction& divisor);
+		BasicIrreducibleFraction operator+() const;
+		BasicIrreducibleFraction operator-() const;
+		// числитель и знаменатель (знаменатель всегда положительный)
+		const Integer& GetNumerator() const;
+		const Integer& GetDenominator() const;
+		// та же дробь без ограничения размера
+		BigIrreducibleFraction ToBigIrreducibleFraction() const;
+
+		friend bool operator<(const BasicIrreducibleFraction& num1, const BasicIrreducibleFraction& num2) {
+			return BasicIrreducibleFraction::GetCompareResult(num1, num2) < 0;
+		}
+		friend bool operator<=(const BasicIrreducibleFraction& num1, const BasicIrreducibleFraction& num2) {
+			return BasicIrreducibleFraction::GetCompareResult(num1, num2) <= 0;
+		}
+		friend bool operator>(const BasicIrreducibleFraction& num1, const BasicIrreducibleFraction& num2) {
+			return BasicIrreducibleFraction::GetCompareResult(num1, num2) > 0;
+		}
+		friend bool operator>=(const BasicIrreducibleFraction& num1, const BasicIrreducibleFraction& num2) {
+			return BasicIrreducibleFraction::GetCompareResult(num1, num2) >= 0;
+		}
+		friend bool operator==(const BasicIrreducibleFraction& num1, const BasicIrreducibleFraction& num2) noexcept {
+			// дроби несократимы и знаменатели положительны, поэтому равные дроби совпадают почленно
+			return (num1.numerator == num2.numerator) && (num1.denominator == num2.denominator);
+		}
+		friend bool operator!=(const BasicIrreducibleFraction& num1, const BasicIrreducibleFraction& num2) noexcept {
+			return !(num1 == num2);
+		}
+		friend std::ostream& operator<<(std::ostream& os, const BasicIrreducibleFraction& num) {
+			return os << num.numerator << '/' << num.denominator;
+		}
+	private:
+		Integer numerator;
+		Integer denominator;
+		// summand1 + numerator2/denominator2 (вторая дробь несократима, denominator2 > 0)
+		static BasicIrreducibleFraction GetSum(const BasicIrreducibleFraction& summand1, const Integer& numerator2, const Integer& denominator2);
+		// multiplier1 * numerator2/denominator2 (вторая дробь несократима, denominator2 > 0)
+		static BasicIrreducibleFraction GetProduct(const BasicIrreducibleFraction& multiplier1, const Integer& numerator2, const Integer& denominator2);
+		// сравнение (1 -> больше; 0 -> равно; -1 -> меньше)
+		static int GetCompareResult(const BasicIrreducibleFraction& num1, const BasicIrreducibleFraction& num2);
+		// перевод целого числа в BigInt
+		static BigInt GetBigInt(const BigInt& num);
+		template <std::size_t Bits>
+		static BigInt GetBigInt(const FixedBigInt<Bits>& num);
+};
+
+// вычисляет operation(num1, num2) над дробями фиксированной ширины, а если результат не помещается,
+// повторяет его над BigIrreducibleFraction; operation должна принимать дроби обоих типов (например, обобщенная лямбда)
+template <std::size_t Bits, typename Operation>
+BigIrreducibleFraction GetWithPromotion(const BasicIrreducibleFraction<FixedBigInt<Bits>>& num1, const BasicIrreducibleFraction<FixedBigInt<Bits>>& num2, Operation operation);
+
+template <typename Integer>
+BasicIrreducibleFraction<Integer>::BasicIrreducibleFraction() : numerator(0), denominator(1) {
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer>::BasicIrreducibleFraction(const Integer& inNumerator, const Integer& inDenominator) {
+	if (inDenominator == 0)
+		throw std::domain_error("BasicIrreducibleFraction: zero denominator");
+	Integer divisor = Integer::GetGreatestCommonDivisor(inNumerator, inDenominator);
+	if (inDenominator < 0)
+		divisor = -divisor;
+	numerator = inNumerator / divisor;
+	denominator = inDenominator / divisor;
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer> BasicIrreducibleFraction<Integer>::CreateFromReduced(const Integer& inNumerator, const Integer& inDenominator) {
+	BasicIrreducibleFraction result;
+	result.numerator = inNumerator;
+	result.denominator = inDenominator;
+	return result;
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer>& BasicIrreducibleFraction<Integer>::operator+=(const BasicIrreducibleFraction& summand) {
+	return *this = *this + summand;
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer>& BasicIrreducibleFraction<Integer>::operator-=(const BasicIrreducibleFraction& subtrahend) {
+	return *this = *this - subtrahend;
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer>& BasicIrreducibleFraction<Integer>::operator*=(const BasicIrreducibleFraction& multiplier) {
+	return *this = *this * multiplier;
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer>& BasicIrreducibleFraction<Integer>::operator/=(const BasicIrreducibleFraction& divisor) {
+	return *this = *this / divisor;
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer> BasicIrreducibleFraction<Integer>::operator+() const {
+	return *this;
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer> BasicIrreducibleFraction<Integer>::operator-() const {
+	// смена знака не нарушает несократимость
+	return CreateFromReduced(-numerator, denominator);
+}
+template <typename Integer>
+const Integer& BasicIrreducibleFraction<Integer>::GetNumerator() const {
+	return numerator;
+}
+template <typename Integer>
+const Integer& BasicIrreducibleFraction<Integer>::GetDenominator() const {
+	return denominator;
+}
+template <typename Integer>
+BigIrreducibleFraction BasicIrreducibleFraction<Integer>::ToBigIrreducibleFraction() const {
+	return BigIrreducibleFraction::CreateFromReduced(GetBigInt(numerator), GetBigInt(denominator));
+}
+
+template <typename Integer>
+BasicIrreducibleFraction<Integer> BasicIrreducibleFraction<Integer>::GetSum(const BasicIrreducibleFraction& summand1, const Integer& numerator2, const Integer& denominator2) {
+	// a/b + c/d при g = НОД(b, d): числитель a*(d/g) + c*(b/g) может делиться только на делители g
+	Integer denominatorsDivisor = Integer::GetGreatestCommonDivisor(summand1.denominator, denominator2);
+	if (denominatorsDivisor == 1)
+		return CreateFromReduced(summand1.numerator * denominator2 + numerator2 * summand1.denominator, summand1.denominator * denominator2);
+	Integer numerator = summand1.numerator * (denominator2 / denominatorsDivisor) + numerator2 * (summand1.denominator / denominatorsDivisor);
+	Integer divisor = Integer::GetGreatestCommonDivisor(numerator, denominatorsDivisor);
+	return CreateFromReduced(numerator / divisor, (summand1.denominator / denominatorsDivisor) * (denominator2 / divisor));
+}
+template <typename Integer>
+BasicIrreducibleFraction<Integer> BasicIrreducibleFraction<Integer>::GetProduct(const BasicIrreducibleFraction& multiplier1, const Integer& numerator2, const Integer& denominator2) {
+	// a/b * c/d: общие множители a и d, c и b сокращаются до умножения
+	Integer divisor1 = Integer::GetGreatestCommonDivisor(multiplier1.numerator, denominator2);
+	Integer divisor2 = Integer::GetGreatestCommonDivisor(numerator2, multiplier1.denominator);
+	return CreateFromReduced((multiplier1.numerator / divisor1) * (numerator2 / divisor2), (multiplier1.denominator / divisor2) * (denominator2 / divisor1));
+}
+template <typename Integer>
+int BasicIrreducibleFraction<Integer>::GetCompareResult(const BasicIrreducibleFraction& num1, const BasicIrreducibleFraction& num2) {
+	if (num1.denominator == num2.denominator)
+		return (num1.numerator == num2.numerator ? 0 : (num1.numerator > num2.numerator ? 1 : -1));
+	// знаменатели положительны, поэтому a/b ? c/d равносильно a*d ? c*b
+	Integer product1 = num1.numerator * num2.denominator;
+	Integer product2 = num2.numerator * num1.denominator;
+	return (product1 == product2 ? 0 : (product1 > product2 ? 1 : -1));
+}
+template <typename Integer>
+BigInt BasicIrreducibleFraction<Integer>::GetBigInt(const BigInt& num) {
+	return num;
+}
+template <typename Integer>
+template <std::size_t Bits>
+BigInt BasicIrreducibleFraction<Integer>::GetBigInt(const FixedBigInt<Bits>& num) {
+	return num.ToBigInt();
+}
+
+template <std::size_t Bits, typename Operation>
+BigIrreducibleFraction GetWithPromotion(const BasicIrreducibleFraction<FixedBigInt<Bits>>& num1, const BasicIrreducibleFraction<FixedBigInt<Bits>>& num2, Operation operation) {
+	try {
+		return BigIrreducibleFraction(operation(num1, num2).ToBigIrreducibleFraction());
+	}
+	catch (const FixedBigIntOverflowException&) {
+		return BigIrreducibleFraction(operation(num1.ToBigIrreducibleFraction(), num2.ToBigIrreducibleFraction()));
+	}
+}
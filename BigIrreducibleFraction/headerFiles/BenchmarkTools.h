@@ -0,0 +1,39 @@
+#pragma once
+
+#include <BigInt.h>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// общие части инструментов замера и проверки (benchmarkSuite, validationSuite, workloadReplay), в библиотеку не входит
+// каждый инструмент - одна единица трансляции, поэтому определения здесь же
+
+// тип сборки, с которой сделаны замеры, задается CMake
+#ifndef BENCHMARK_BUILD_TYPE
+#define BENCHMARK_BUILD_TYPE "unknown"
+#endif
+
+namespace BenchmarkTools {
+	// накапливает размеры результатов, чтобы компилятор не выбросил замеряемые операции
+	static volatile std::size_t sink = 0;
+
+	// случайное положительное число из digitsCount цифр (digitsCount >= 1) с ненулевой старшей цифрой
+	inline BigInt GetRandomNumber(const std::size_t& digitsCount, std::mt19937_64& generator) {
+		std::string digits(digitsCount, '0');
+		digits[0] = (char)('1' + generator() % 9);
+		for (std::size_t i = 1; i < digitsCount; ++i)
+			digits[i] = (char)('0' + generator() % 10);
+		return BigInt(digits);
+	}
+	// размеры 1, 3, 10, 30, ... не больше maxDigitsCount
+	inline std::vector<std::size_t> GetDigitsCounts(const std::size_t& maxDigitsCount) {
+		std::vector<std::size_t> digitsCounts;
+		for (std::size_t powerOfTen = 1; powerOfTen <= maxDigitsCount; powerOfTen *= 10) {
+			digitsCounts.push_back(powerOfTen);
+			if (3 * powerOfTen <= maxDigitsCount)
+				digitsCounts.push_back(3 * powerOfTen);
+		}
+		return digitsCounts;
+	}
+}
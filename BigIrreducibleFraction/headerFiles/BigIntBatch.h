@@ -0,0 +1,51 @@
+#pragma once
+
+#include <BigInt.h>
+#include <BigIntExport.h>
+#include <algorithm>
+#include <stdexcept>
+
+// набор из многих BigInt в виде структуры массивов
+// значения с модулем не больше laneLimit хранятся подряд в массиве long long (дорожках), остальные - отдельно как BigInt
+// операции над наборами идут по элементам: сначала простой цикл по дорожкам без ветвлений, который компилятор векторизует,
+// затем редкие элементы, вышедшие за laneLimit, пересчитываются через BigInt
+class BIGINT_API BigIntBatch {
+public:
+	BigIntBatch();
+	BigIntBatch(const std::vector<BigInt>& nums);
+	std::size_t GetSize() const;
+	void Reserve(const std::size_t& size);
+	void PushBack(const BigInt& num);
+	void PushBack(const long long& num);
+	BigInt Get(const std::size_t& index) const;
+	std::vector<BigInt> ToVector() const;
+	// количество элементов, хранящихся как BigInt
+	std::size_t GetOverflowsCount() const;
+	// поэлементные сумма и произведение наборов одного размера
+	static BigIntBatch GetSum(const BigIntBatch& batch1, const BigIntBatch& batch2);
+	static BigIntBatch GetProduct(const BigIntBatch& batch1, const BigIntBatch& batch2);
+	// поэлементное сравнение наборов одного размера (1 -> больше; 0 -> равно; -1 -> меньше)
+	static std::vector<int> GetCompareResults(const BigIntBatch& batch1, const BigIntBatch& batch2);
+	// сумма всех элементов набора
+	BigInt GetTotalSum() const;
+	friend class BigIrreducibleFractionBatch;
+private:
+	// наибольший модуль значения в дорожке: сумма и произведение двух таких значений помещаются в long long
+	static const long long laneLimit = 2147483647;
+	// количество дорожек, суммируемых в long long без переполнения
+	static const std::size_t laneSumBlockSize = 1 << 30;
+	// значения элементов (0 для элементов, хранящихся как BigInt)
+	std::vector<long long> lanes;
+	// хранится ли элемент как BigInt
+	std::vector<unsigned char> isOverflowed;
+	// номера элементов, хранящихся как BigInt, по возрастанию, и их значения
+	std::vector<std::size_t> overflowIndexes;
+	std::vector<BigInt> overflowValues;
+	// значение num в long long, если его модуль не больше laneLimit
+	static bool TryGetLaneValue(const BigInt& num, long long& value);
+	// запись результата элемента, посчитанного через BigInt (элементы записываются по возрастанию номеров)
+	void SetOverflowResult(const std::size_t& index, const BigInt& num);
+	static void CheckSizes(const BigIntBatch& batch1, const BigIntBatch& batch2);
+	// отмечает в needsBigInt элементы, которые нужно пересчитать через BigInt
+	static void MarkOverflows(const BigIntBatch& batch1, const BigIntBatch& batch2, const std::vector<long long>& results, std::vector<unsigned char>& needsBigInt);
+};
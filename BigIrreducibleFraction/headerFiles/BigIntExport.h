@@ -0,0 +1,16 @@
+#pragma once
+
+// видимость символов библиотеки: в разделяемой сборке (BIGINT_SHARED) наружу видны только классы и функции с BIGINT_API,
+// остальное (вспомогательные функции единиц трансляции, встроенные функции) скрыто и не попадает в таблицу экспорта
+// в статической сборке и при сборке без CMake макрос ничего не меняет
+#if defined(_WIN32) && defined(BIGINT_SHARED)
+#ifdef BIGINT_BUILDING_LIBRARY
+#define BIGINT_API __declspec(dllexport)
+#else
+#define BIGINT_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__)
+#define BIGINT_API __attribute__((visibility("default")))
+#else
+#define BIGINT_API
+#endif
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <BigInt.h>
+#include <BigIntExport.h>
+#include <deque>
+#include <limits>
+
+// слой шаблонов выражений над BigInt, включается явно через Fuse
+// выражение строится из Fuse(num) и операторов +, -, * и вычисляется при преобразовании в BigInt:
+// оно раскладывается в сумму произведений не более чем двух чисел со знаками, размер результата считается один раз,
+// и все произведения складываются в один буфер разрядов с одной нормализацией переносов
+// например, BigInt x = Fuse(a) * d + Fuse(b) * c; не создает промежуточных BigInt для a * d и b * c
+// узлы выражения хранят ссылки на числа, поэтому выражение вычисляется в том же полном выражении, где построено
+
+// слагаемое развернутого выражения: ±factor1 * factor2 (factor2 == nullptr - просто ±factor1)
+struct BigIntFusedTerm {
+	const std::vector<int>* factor1;
+	const std::vector<int>* factor2;
+	bool isNegative;
+};
+
+// значения подвыражений, которые не раскладываются в сумму произведений двух чисел (например, a * b * c)
+typedef std::deque<BigInt> BigIntTemporaries;
+
+// вычисление суммы слагаемых в одном буфере
+class BIGINT_API BigIntFusedEvaluator {
+public:
+	static BigInt GetSum(const std::vector<BigIntFusedTerm>& terms);
+	// слагаемое ±num
+	static BigIntFusedTerm GetTerm(const BigInt& num, const bool& isNegative);
+	// слагаемое ±num1 * num2
+	static BigIntFusedTerm GetTerm(const BigInt& num1, const BigInt& num2, const bool& isNegative);
+private:
+	// цифры суммы в буфере с разрядами типа Column, возвращает знак суммы
+	template <typename Column>
+	static bool GetSumDigits(const std::vector<BigIntFusedTerm>& terms, const std::size_t& size, std::vector<int>& digits);
+};
+
+// базовый класс узлов выражения (Derived - класс узла)
+template <typename Derived>
+class BigIntExpression {
+public:
+	BigInt Evaluate() const;
+	operator BigInt() const;
+	const Derived& GetDerived() const;
+	// значение узла как множитель; по умолчанию узел вычисляется в temporaries
+	const BigInt& GetFactor(BigIntTemporaries& temporaries) const;
+};
+
+// число в выражении
+class BIGINT_API BigIntLeaf : public BigIntExpression<BigIntLeaf> {
+public:
+	BigIntLeaf(const BigInt& value);
+	void CollectTerms(std::vector<BigIntFusedTerm>& terms, const bool& isNegative, BigIntTemporaries& temporaries) const;
+	const BigInt& GetFactor(BigIntTemporaries& temporaries) const;
+private:
+	const BigInt& value;
+};
+
+// произведение двух подвыражений
+template <typename Left, typename Right>
+class BigIntProductExpression : public BigIntExpression<BigIntProductExpression<Left, Right>> {
+public:
+	BigIntProductExpression(const Left& left, const Right& right);
+	void CollectTerms(std::vector<BigIntFusedTerm>& terms, const bool& isNegative, BigIntTemporaries& temporaries) const;
+private:
+	Left left;
+	Right right;
+};
+
+// сумма или разность двух подвыражений
+template <typename Left, typename Right>
+class BigIntSumExpression : public BigIntExpression<BigIntSumExpression<Left, Right>> {
+public:
+	BigIntSumExpression(const Left& left, const Right& right, const bool& isSubtraction);
+	void CollectTerms(std::vector<BigIntFusedTerm>& terms, const bool& isNegative, BigIntTemporaries& temporaries) const;
+private:
+	Left left;
+	Right right;
+	bool isSubtraction;
+};
+
+// начало выражения
+BIGINT_API BigIntLeaf Fuse(const BigInt& num);
+
+template <typename Left, typename Right>
+BigIntSumExpression<Left, Right> operator+(const BigIntExpression<Left>& left, const BigIntExpression<Right>& right);
+template <typename Left>
+BigIntSumExpression<Left, BigIntLeaf> operator+(const BigIntExpression<Left>& left, const BigInt& right);
+template <typename Right>
+BigIntSumExpression<BigIntLeaf, Right> operator+(const BigInt& left, const BigIntExpression<Right>& right);
+template <typename Left, typename Right>
+BigIntSumExpression<Left, Right> operator-(const BigIntExpression<Left>& left, const BigIntExpression<Right>& right);
+template <typename Left>
+BigIntSumExpression<Left, BigIntLeaf> operator-(const BigIntExpression<Left>& left, const BigInt& right);
+template <typename Right>
+BigIntSumExpression<BigIntLeaf, Right> operator-(const BigInt& left, const BigIntExpression<Right>& right);
+template <typename Left, typename Right>
+BigIntProductExpression<Left, Right> operator*(const BigIntExpression<Left>& left, const BigIntExpression<Right>& right);
+template <typename Left>
+BigIntProductExpression<Left, BigIntLeaf> operator*(const BigIntExpression<Left>& left, const BigInt& right);
+template <typename Right>
+BigIntProductExpression<BigIntLeaf, Right> operator*(const BigInt& left, const BigIntExpression<Right>& right);
+
+template <typename Column>
+bool BigIntFusedEvaluator::GetSumDigits(const std::vector<BigIntFusedTerm>& terms, const std::size_t& size, std::vector<int>& digits) {
+	// разряды копятся со знаком без переносов
+	std::vector<Column> columns(size, 0);
+	for (std::size_t t = 0; t < terms.size(); ++t) {
+		const std::vector<int>& factor1 = *terms[t].factor1;
+		Column sign = (terms[t].isNegative ? -1 : 1);
+		if (terms[t].factor2 == nullptr) {
+			for (std::size_t i = 0; i < factor1.size(); ++i)
+				columns[i] += sign * factor1[i];
+			continue;
+		}
+		const std::vector<int>& factor2 = *terms[t].factor2;
+		if ((factor1.size() < BigInt::karatsubaThreshold.load()) || (factor2.size() < BigInt::karatsubaThreshold.load())) {
+			// малые произведения добавляются в буфер столбиком прямо на месте
+			for (std::size_t i = 0; i < factor1.size(); ++i) {
+				OperationContext::Checkpoint();
+				Column signedDigit = sign * factor1[i];
+				if (signedDigit == 0)
+					continue;
+				Column* row = columns.data() + i;
+				for (std::size_t j = 0; j < factor2.size(); ++j)
+					row[j] += signedDigit * factor2[j];
+			}
+		}
+		else {
+			// большие произведения считаются методом Карацубы и добавляются в буфер
+			std::vector<int> product = BigInt::GetVectorsKaratsubaProduct(factor1, factor2, BigInt::GetMultiplicationParallelDepth());
+			for (std::size_t i = 0; (i < product.size()) && (i < size); ++i)
+				columns[i] += sign * product[i];
+		}
+	}
+	// единственная нормализация переносов
+	digits.resize(size);
+	Column carry = 0;
+	for (std::size_t i = 0; i < size; ++i) {
+		Column value = columns[i] + carry;
+		Column digit = value % 10;
+		carry = value / 10;
+		if (digit < 0) {
+			digit += 10;
+			--carry;
+		}
+		digits[i] = (int)digit;
+	}
+	// отрицательная сумма равна digits - 10^size, ее модуль - дополнение digits до 10^size
+	bool isNegative = (carry < 0);
+	if (isNegative) {
+		std::size_t i = 0;
+		while ((i < size) && (digits[i] == 0))
+			++i;
+		if (i < size) {
+			digits[i] = 10 - digits[i];
+			for (++i; i < size; ++i)
+				digits[i] = 9 - digits[i];
+		}
+	}
+	return isNegative;
+}
+template <typename Derived>
+BigInt BigIntExpression<Derived>::Evaluate() const {
+	std::vector<BigIntFusedTerm> terms;
+	BigIntTemporaries temporaries;
+	GetDerived().CollectTerms(terms, false, temporaries);
+	return BigIntFusedEvaluator::GetSum(terms);
+}
+template <typename Derived>
+BigIntExpression<Derived>::operator BigInt() const {
+	return Evaluate();
+}
+template <typename Derived>
+const Derived& BigIntExpression<Derived>::GetDerived() const {
+	return static_cast<const Derived&>(*this);
+}
+template <typename Derived>
+const BigInt& BigIntExpression<Derived>::GetFactor(BigIntTemporaries& temporaries) const {
+	temporaries.push_back(Evaluate());
+	return temporaries.back();
+}
+
+template <typename Left, typename Right>
+BigIntProductExpression<Left, Right>::BigIntProductExpression(const Left& inputLeft, const Right& inputRight) : left(inputLeft), right(inputRight) {
+}
+template <typename Left, typename Right>
+void BigIntProductExpression<Left, Right>::CollectTerms(std::vector<BigIntFusedTerm>& terms, const bool& isNegative, BigIntTemporaries& temporaries) const {
+	const BigInt& leftFactor = left.GetFactor(temporaries);
+	const BigInt& rightFactor = right.GetFactor(temporaries);
+	terms.push_back(BigIntFusedEvaluator::GetTerm(leftFactor, rightFactor, isNegative));
+}
+
+template <typename Left, typename Right>
+BigIntSumExpression<Left, Right>::BigIntSumExpression(const Left& inputLeft, const Right& inputRight, const bool& inputIsSubtraction) : left(inputLeft), right(inputRight) {
+	isSubtraction = inputIsSubtraction;
+}
+template <typename Left, typename Right>
+void BigIntSumExpression<Left, Right>::CollectTerms(std::vector<BigIntFusedTerm>& terms, const bool& isNegative, BigIntTemporaries& temporaries) const {
+	left.CollectTerms(terms, isNegative, temporaries);
+	right.CollectTerms(terms, isNegative != isSubtraction, temporaries);
+}
+
+template <typename Left, typename Right>
+BigIntSumExpression<Left, Right> operator+(const BigIntExpression<Left>& left, const BigIntExpression<Right>& right) {
+	return BigIntSumExpression<Left, Right>(left.GetDerived(), right.GetDerived(), false);
+}
+template <typename Left>
+BigIntSumExpression<Left, BigIntLeaf> operator+(const BigIntExpression<Left>& left, const BigInt& right) {
+	return BigIntSumExpression<Left, BigIntLeaf>(left.GetDerived(), BigIntLeaf(right), false);
+}
+template <typename Right>
+BigIntSumExpression<BigIntLeaf, Right> operator+(const BigInt& left, const BigIntExpression<Right>& right) {
+	return BigIntSumExpression<BigIntLeaf, Right>(BigIntLeaf(left), right.GetDerived(), false);
+}
+template <typename Left, typename Right>
+BigIntSumExpression<Left, Right> operator-(const BigIntExpression<Left>& left, const BigIntExpression<Right>& right) {
+	return BigIntSumExpression<Left, Right>(left.GetDerived(), right.GetDerived(), true);
+}
+template <typename Left>
+BigIntSumExpression<Left, BigIntLeaf> operator-(const BigIntExpression<Left>& left, const BigInt& right) {
+	return BigIntSumExpression<Left, BigIntLeaf>(left.GetDerived(), BigIntLeaf(right), true);
+}
+template <typename Right>
+BigIntSumExpression<BigIntLeaf, Right> operator-(const BigInt& left, const BigIntExpression<Right>& right) {
+	return BigIntSumExpression<BigIntLeaf, Right>(BigIntLeaf(left), right.GetDerived(), true);
+}
+template <typename Left, typename Right>
+BigIntProductExpression<Left, Right> operator*(const BigIntExpression<Left>& left, const BigIntExpression<Right>& right) {
+	return BigIntProductExpression<Left, Right>(left.GetDerived(), right.GetDerived());
+}
+template <typename Left>
+BigIntProductExpression<Left, BigIntLeaf> operator*(const BigIntExpression<Left>& left, const BigInt& right) {
+	return BigIntProductExpression<Left, BigIntLeaf>(left.GetDerived(), BigIntLeaf(right));
+}
+template <typename Right>
+BigIntProductExpression<BigIntLeaf, Right> operator*(const BigInt& left, const BigIntExpression<Right>& right) {
+	return BigIntProductExpression<BigIntLeaf, Right>(BigIntLeaf(left), right.GetDerived());
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <BigIrreducibleFraction.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// компактная двоичная запись BigInt и дробей (трассы WorkloadRecorder, протокол fractionServer)
+// беззнаковое целое - varint: по 7 бит от младших, старший бит байта - признак продолжения
+// число - varint (количество цифр * 2 + знак, 0 для нуля), затем цифры от младших, по две в байте (младшая в младших 4 битах)
+// дробь - числитель и знаменатель
+class BIGINT_API BigIntSerialization {
+public:
+	static void AppendVarint(std::string& buffer, unsigned long long value);
+	// isDigitsIncluded = false - пишется только заголовок числа (знак и количество цифр), как в трассе режима Sizes
+	static void AppendNumber(std::string& buffer, const BigInt& num, const bool& isDigitsIncluded = true);
+	static void AppendFraction(std::string& buffer, const BigIrreducibleFraction& num);
+	// чтение с position, который сдвигается за прочитанное; при обрыве или порче данных - std::invalid_argument
+	static unsigned long long ReadVarint(const char*& position, const char* end);
+	static BigInt ReadNumber(const char*& position, const char* end);
+	// цифры числа от младших, записанные после заголовка с количеством цифр digitsCount
+	static std::vector<int> ReadDigits(const char*& position, const char* end, const unsigned long long& digitsCount);
+	// isTrustedReduced - дробь записана AppendFraction и не сокращается повторно, иначе проверяется знаменатель и считается НОД
+	static BigIrreducibleFraction ReadFraction(const char*& position, const char* end, const bool& isTrustedReduced);
+};
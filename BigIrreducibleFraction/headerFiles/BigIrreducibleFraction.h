@@ -1,194 +1,136 @@
 #pragma once
 
 #include <BigInt.h>
+#include <BigIntExport.h>
+#include <BigIntExpression.h>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
 
-class BigIrreducibleFraction {
+class ContinuedFractionGenerator;
+
+class BIGINT_API BigIrreducibleFraction {
 	public:
 		BigIrreducibleFraction();
 		BigIrreducibleFraction(const std::string& irreducibleFraction);
 		BigIrreducibleFraction(const BigInt& numerator, const BigInt& denominator);
-		BigIrreducibleFraction operator+(const BigIrreducibleFraction& summand);
-		BigIrreducibleFraction operator-(const BigIrreducibleFraction& subtrahend);
-		BigIrreducibleFraction operator*(const BigIrreducibleFraction& multiplier);
-		BigIrreducibleFraction operator/(const BigIrreducibleFraction& divisor);
-		BigIrreducibleFraction operator+=(const BigIrreducibleFraction& summand);
-		BigIrreducibleFraction operator-=(const BigIrreducibleFraction& subtrahend);
-		BigIrreducibleFraction operator*=(const BigIrreducibleFraction& multiplier);
-		BigIrreducibleFraction operator/=(const BigIrreducibleFraction& divisor);
+		// дробь из заведомо несократимых числителя и знаменателя (знаменатель > 0), без подсчета НОД
+		static BigIrreducibleFraction CreateFromReduced(const BigInt& numerator, const BigInt& denominator);
+		// бинарные операторы - свободные функции, константные методы и операторы только читают дробь,
+		// поэтому одну дробь можно одновременно использовать из многих потоков без блокировок, пока ее никто не меняет
+		friend BIGINT_API BigIrreducibleFraction operator+(const BigIrreducibleFraction& summand1, const BigIrreducibleFraction& summand2);
+		friend BIGINT_API BigIrreducibleFraction operator-(const BigIrreducibleFraction& minuend, const BigIrreducibleFraction& subtrahend);
+		friend BIGINT_API BigIrreducibleFraction operator*(const BigIrreducibleFraction& multiplier1, const BigIrreducibleFraction& multiplier2);
+		friend BIGINT_API BigIrreducibleFraction operator/(const BigIrreducibleFraction& dividend, const BigIrreducibleFraction& divisor);
+		BigIrreducibleFraction& operator+=(const BigIrreducibleFraction& summand);
+		BigIrreducibleFraction& operator-=(const BigIrreducibleFraction& subtrahend);
+		BigIrreducibleFraction& operator*=(const BigIrreducibleFraction& multiplier);
+		BigIrreducibleFraction& operator/=(const BigIrreducibleFraction& divisor);
 		BigIrreducibleFraction& operator++();
 		BigIrreducibleFraction& operator--();
 		BigIrreducibleFraction operator++(int);
 		BigIrreducibleFraction operator--(int);
-		BigIrreducibleFraction operator+();
-		BigIrreducibleFraction operator-();
-		BigIrreducibleFraction operator=(const std::string& irreducibleFraction);
+		BigIrreducibleFraction operator+() const;
+		BigIrreducibleFraction operator-() const;
+		BigIrreducibleFraction& operator=(const std::string& irreducibleFraction);
+		// числитель и знаменатель (знаменатель всегда положительный)
+		const BigInt& GetNumerator() const;
+		const BigInt& GetDenominator() const;
+		// значение в виде числа с плавающей точкой, корректно округленное к ближайшему
+		// считается по старшим цифрам числителя и знаменателя, полное деление нужно только если округление на границе
+		double ToDouble() const;
+		long double ToLongDouble() const;
+		// десятичная запись с significantDigitsCount значащими цифрами (округление половины вверх по модулю)
+		// как у printf("%g"), но без отбрасывания нулей: при порядке от -4 до significantDigitsCount запись обычная, иначе экспоненциальная
+		std::string ToDecimalString(const std::size_t& significantDigitsCount) const;
+		// ленивый генератор элементов цепной дроби
+		ContinuedFractionGenerator GetContinuedFraction() const;
+		// ближайшая дробь со знаменателем не больше maxDenominator (maxDenominator >= 1)
+		BigIrreducibleFraction LimitDenominator(const BigInt& maxDenominator) const;
+		// точный квадратный корень, если он рациональный (тогда он записывается в root и возвращается true)
+		// дробь несократима, поэтому корень есть только у дробей, числитель и знаменатель которых - квадраты
+		bool TryGetSquareRoot(BigIrreducibleFraction& root) const;
 
-		bool operator<(const BigIrreducibleFraction& num);
-		bool operator<=(const BigIrreducibleFraction& num);
-		bool operator>(const BigIrreducibleFraction& num);
-		bool operator>=(const BigIrreducibleFraction& num);
-		bool operator==(const BigIrreducibleFraction& num);
-		bool operator!=(const BigIrreducibleFraction& num);
+		friend BIGINT_API bool operator<(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2);
+		friend BIGINT_API bool operator<=(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2);
+		friend BIGINT_API bool operator>(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2);
+		friend BIGINT_API bool operator>=(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2);
+		friend BIGINT_API bool operator==(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) noexcept;
+		friend BIGINT_API bool operator!=(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) noexcept;
+		// хэш из хэшей числителя и знаменателя (они кэшируются внутри BigInt)
+		std::size_t GetHash() const noexcept;
 
-		friend std::ostream& operator<<(std::ostream& os, const BigIrreducibleFraction& num);
+		friend BIGINT_API std::ostream& operator<<(std::ostream& os, const BigIrreducibleFraction& num);
+		friend class BigIrreducibleFractionBatch;
 	private:
 		BigInt numerator;
 		BigInt denominator;
 		static BigIrreducibleFraction Reduce(BigIrreducibleFraction num);
+		// сравнение (1 -> больше; 0 -> равно; -1 -> меньше)
+		static int GetCompareResult(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2);
+		// оценка модуля дроби: lower * 10^exponent <= |дробь| <= upper * 10^exponent
+		// считается по precision старшим цифрам числителя и знаменателя, с ростом precision оценка сужается до точного значения
+		void GetDecimalBounds(const std::size_t& precision, BigInt& lower, BigInt& upper, long long& exponent) const;
+		// округление десятичного числа digits * 10^exponent до significantDigitsCount значащих цифр
+		// возвращает цифры результата, в decimalExponent - порядок первой цифры
+		static std::string GetRoundedDigits(const std::string& digits, const long long& exponent, const std::size_t& significantDigitsCount, long long& decimalExponent);
+		// перевод десятичной строки в число с плавающей точкой с корректным округлением
+		static void ParseFloatingPoint(const std::string& decimal, double& result);
+		static void ParseFloatingPoint(const std::string& decimal, long double& result);
+		template <typename FloatingPoint>
+		FloatingPoint ToFloatingPoint() const;
 };
 
-BigIrreducibleFraction BigIrreducibleFraction::Reduce(BigIrreducibleFraction num) {
-	BigInt nod = 1;
-	do {
-		BigInt numNumeratorCopy = (num.numerator > 0 ? num.numerator : -num.numerator);
-		BigInt numDenominatorCopy = (num.denominator > 0 ? num.denominator : -num.denominator);
-		while ((numNumeratorCopy != 0) && (numDenominatorCopy != 0))
-			if (numNumeratorCopy > numDenominatorCopy)
-				numNumeratorCopy %= numDenominatorCopy;
-			else
-				numDenominatorCopy %= numNumeratorCopy;
-		BigInt nod = numNumeratorCopy + numDenominatorCopy;
-		num.numerator /= nod;
-		num.denominator /= nod;
-	} while (nod != 1);
-	if (num.denominator < 0)
-		num *= BigIrreducibleFraction(-1, 1);
-	return num;
-}
-BigIrreducibleFraction::BigIrreducibleFraction() {
-	numerator = 0;
-	denominator = 1;
-}
-BigIrreducibleFraction::BigIrreducibleFraction(const std::string& irreducibleFraction) {
-	int forwardSlashPos = irreducibleFraction.find('/');
-	if (forwardSlashPos == std::string::npos) {
-		numerator = irreducibleFraction;
-		denominator = 1;
-	}
-	else {
-		numerator = irreducibleFraction.substr(0, forwardSlashPos);
-		denominator = irreducibleFraction.substr(forwardSlashPos + 1, irreducibleFraction.length() - forwardSlashPos - 1);
-	}
-	BigInt nod = 1;
-	do {
-		BigInt numNumeratorCopy = (numerator > 0 ? numerator : -numerator);
-		BigInt numDenominatorCopy = (denominator > 0 ? denominator : -denominator);
-		while ((numNumeratorCopy != 0) && (numDenominatorCopy != 0))
-			if (numNumeratorCopy > numDenominatorCopy)
-				numNumeratorCopy %= numDenominatorCopy;
-			else
-				numDenominatorCopy %= numNumeratorCopy;
-		BigInt nod = numNumeratorCopy + numDenominatorCopy;
-		numerator /= nod;
-		denominator /= nod;
-	} while (nod != 1);
-	if (denominator < 0) {
-		numerator *= -1;
-		denominator *= -1;
-	}
-}
-BigIrreducibleFraction::BigIrreducibleFraction(const BigInt& inNumerator, const BigInt& inDenominator) {
-	numerator = inNumerator;
-	denominator = inDenominator;
-	BigInt nod = 1;
-	do {
-		BigInt numNumeratorCopy = (numerator > 0 ? numerator : -numerator);
-		BigInt numDenominatorCopy = (denominator > 0 ? denominator : -denominator);
-		while ((numNumeratorCopy != 0) && (numDenominatorCopy != 0))
-			if (numNumeratorCopy > numDenominatorCopy)
-				numNumeratorCopy %= numDenominatorCopy;
-			else
-				numDenominatorCopy %= numNumeratorCopy;
-		BigInt nod = numNumeratorCopy + numDenominatorCopy;
-		numerator /= nod;
-		denominator /= nod;
-	} while (nod != 1);
-	if (denominator < 0) {
-		numerator *= -1;
-		denominator *= -1;
-	}
+namespace std {
+	template <>
+	struct BIGINT_API hash<BigIrreducibleFraction> {
+		std::size_t operator()(const BigIrreducibleFraction& num) const noexcept;
+	};
 }
 
-BigIrreducibleFraction BigIrreducibleFraction::operator+(const BigIrreducibleFraction & summand) {
-	return Reduce(BigIrreducibleFraction(this->numerator * summand.denominator + this->denominator * summand.numerator, this->denominator * summand.denominator));
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator-(const BigIrreducibleFraction & subtrahend) {
-	return Reduce(BigIrreducibleFraction(this->numerator * subtrahend.denominator - this->denominator * subtrahend.numerator, this->denominator * subtrahend.denominator));
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator*(const BigIrreducibleFraction& multiplier) {
-	return Reduce(BigIrreducibleFraction(this->numerator * multiplier.numerator, this->denominator * multiplier.denominator));
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator/(const BigIrreducibleFraction& divisor) {
-	return Reduce(BigIrreducibleFraction(this->numerator * divisor.denominator, this->denominator * divisor.numerator));
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator+=(const BigIrreducibleFraction & summand) {
-	return *this = *this + summand;
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator-=(const BigIrreducibleFraction & subtrahend) {
-	return *this = *this - subtrahend;
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator*=(const BigIrreducibleFraction & multiplier){
-	return *this = *this * multiplier;
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator/=(const BigIrreducibleFraction & divisor){
-	return *this = *this / divisor;
-}
-BigIrreducibleFraction& BigIrreducibleFraction::operator++() {
-	BigIrreducibleFraction one(1, 1);
-	return *this = *this + one;
-}
-BigIrreducibleFraction& BigIrreducibleFraction::operator--() {
-	BigIrreducibleFraction one(1, 1);
-	return *this = *this - one;
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator++(int) {
-	BigIrreducibleFraction temp = *this;
-	++*this;
-	return temp;
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator--(int) {
-	BigIrreducibleFraction temp = *this;
-	--*this;
-	return temp;
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator+() {
-	return *this;
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator-() {
-	BigIrreducibleFraction one(-1, 1);
-	return *this * one;
-}
-bool BigIrreducibleFraction::operator<(const BigIrreducibleFraction& num) {
-	return (*this - num).numerator < 0;
-}
-bool BigIrreducibleFraction::operator<=(const BigIrreducibleFraction& num) {
-	return (*this - num).numerator <= 0;
-}
-bool BigIrreducibleFraction::operator>(const BigIrreducibleFraction& num) {
-	return (*this - num).numerator > 0;
-}
-bool BigIrreducibleFraction::operator>=(const BigIrreducibleFraction& num) {
-	return (*this - num).numerator >= 0;
-}
-bool BigIrreducibleFraction::operator==(const BigIrreducibleFraction& num) {
-	return (*this - num).numerator == 0;
-}
-bool BigIrreducibleFraction::operator!=(const BigIrreducibleFraction& num) {
-	return (*this - num).numerator != 0;
-}
-BigIrreducibleFraction BigIrreducibleFraction::operator=(const std::string& irreducibleFraction){
-	int forwardSlashPos = irreducibleFraction.find('/');
-	if (forwardSlashPos == std::string::npos) {
-		numerator = irreducibleFraction;
-		denominator = 1;
-	}
-	else {
-		numerator = irreducibleFraction.substr(0, forwardSlashPos);
-		denominator = irreducibleFraction.substr(forwardSlashPos + 1, irreducibleFraction.length() - forwardSlashPos - 1);
+// генератор элементов цепной дроби [a0; a1, a2, ...], элементы считаются по требованию
+// a0 - целая часть (округление вниз), остальные элементы положительны
+// шаг Лемера находит сразу несколько элементов по старшим цифрам, после чего большие числа обновляются один раз
+class BIGINT_API ContinuedFractionGenerator {
+public:
+	ContinuedFractionGenerator(const BigIrreducibleFraction& num);
+	bool HasNextTerm() const;
+	// после последнего элемента - std::out_of_range
+	BigInt GetNextTerm();
+private:
+	// текущая пара алгоритма Евклида (dividend >= divisor >= 0)
+	BigInt dividend;
+	BigInt divisor;
+	// элементы, уже найденные, но еще не выданные
+	std::deque<BigInt> pendingTerms;
+	// количество старших цифр, по которым делается шаг Лемера (помещаются в long long вместе со знаком и переносом)
+	static const std::size_t lehmerDigitsCount = 18;
+	// находит следующие элементы и кладет их в pendingTerms
+	void FindNextTerms();
+	// старшие цифры числа num, начиная с разряда shift
+	static long long GetDigitsFrom(const BigInt& num, const std::size_t& shift);
+};
+
+template <typename FloatingPoint>
+FloatingPoint BigIrreducibleFraction::ToFloatingPoint() const {
+	if (numerator == 0)
+		return 0;
+	FloatingPoint result = 0;
+	// границы, совпавшие после округления, дают корректно округленный результат, так как округление монотонно
+	for (std::size_t precision = std::numeric_limits<FloatingPoint>::max_digits10 + 8;; precision *= 2) {
+		BigInt lower, upper;
+		long long exponent;
+		GetDecimalBounds(precision, lower, upper, exponent);
+		std::ostringstream lowerStream, upperStream;
+		lowerStream << lower << 'e' << exponent;
+		upperStream << upper << 'e' << exponent;
+		FloatingPoint upperResult;
+		ParseFloatingPoint(lowerStream.str(), result);
+		ParseFloatingPoint(upperStream.str(), upperResult);
+		if (result == upperResult)
+			break;
 	}
-	return *this;
-}
-std::ostream& operator<<(std::ostream& os, const BigIrreducibleFraction& num) {
-	os << num.numerator << '/' << num.denominator;
-	return os;
+	return (numerator.isNegative ? -result : result);
 }
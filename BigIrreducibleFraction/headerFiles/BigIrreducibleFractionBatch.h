@@ -0,0 +1,43 @@
+#pragma once
+
+#include <BigIntBatch.h>
+#include <BigIntExport.h>
+#include <BigIrreducibleFraction.h>
+
+// набор из многих BigIrreducibleFraction в виде структуры массивов
+// дроби, у которых модули числителя и знаменателя не больше BigIntBatch::laneLimit, хранятся в двух массивах long long,
+// остальные - отдельно как BigIrreducibleFraction; как и в BigIntBatch, через BigInt считаются только элементы, вышедшие за предел
+class BIGINT_API BigIrreducibleFractionBatch {
+public:
+	BigIrreducibleFractionBatch();
+	BigIrreducibleFractionBatch(const std::vector<BigIrreducibleFraction>& fractions);
+	std::size_t GetSize() const;
+	void Reserve(const std::size_t& size);
+	void PushBack(const BigIrreducibleFraction& fraction);
+	BigIrreducibleFraction Get(const std::size_t& index) const;
+	std::vector<BigIrreducibleFraction> ToVector() const;
+	// количество элементов, хранящихся как BigIrreducibleFraction
+	std::size_t GetOverflowsCount() const;
+	// поэлементные сумма и произведение наборов одного размера
+	static BigIrreducibleFractionBatch GetSum(const BigIrreducibleFractionBatch& batch1, const BigIrreducibleFractionBatch& batch2);
+	static BigIrreducibleFractionBatch GetProduct(const BigIrreducibleFractionBatch& batch1, const BigIrreducibleFractionBatch& batch2);
+	// поэлементное сравнение наборов одного размера (1 -> больше; 0 -> равно; -1 -> меньше)
+	static std::vector<int> GetCompareResults(const BigIrreducibleFractionBatch& batch1, const BigIrreducibleFractionBatch& batch2);
+	// сумма всех элементов набора
+	BigIrreducibleFraction GetTotalSum() const;
+private:
+	// числители и знаменатели (знаменатель > 0; 0/1 для элементов, хранящихся как BigIrreducibleFraction)
+	std::vector<long long> numeratorLanes;
+	std::vector<long long> denominatorLanes;
+	std::vector<unsigned char> isOverflowed;
+	// номера элементов, хранящихся как BigIrreducibleFraction, по возрастанию, и их значения
+	std::vector<std::size_t> overflowIndexes;
+	std::vector<BigIrreducibleFraction> overflowValues;
+	// сокращение дроби numerator/denominator (denominator > 0), модули которой помещаются в long long
+	static void ReduceLanes(long long& numerator, long long& denominator);
+	// запись результата элемента: несокращенной дроби из дорожек или посчитанной через BigIrreducibleFraction
+	// (элементы записываются по возрастанию номеров)
+	void SetLanesResult(const std::size_t& index, long long numerator, long long denominator);
+	void SetOverflowResult(const std::size_t& index, const BigIrreducibleFraction& fraction);
+	static void CheckSizes(const BigIrreducibleFractionBatch& batch1, const BigIrreducibleFractionBatch& batch2);
+};
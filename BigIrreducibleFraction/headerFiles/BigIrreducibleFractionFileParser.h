@@ -0,0 +1,28 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <BigIrreducibleFraction.h>
+#include <ParallelExecution.h>
+#include <fstream>
+#include <stdexcept>
+
+// массовая загрузка дробей из текста, где на каждой строке одна дробь вида p/q или целое p
+// пустые строки пропускаются, пробелы и '\r' по краям строки игнорируются
+// текст делится на куски по границам строк, куски разбираются параллельно, результат идет в исходном порядке
+class BIGINT_API BigIrreducibleFractionFileParser {
+public:
+	// разбор файла, отображенного в память
+	// isTrustedReduced - дроби в файле уже несократимы и знаменатели положительны, НОД не считается
+	static std::vector<BigIrreducibleFraction> ParseFile(const std::string& path, const bool& isTrustedReduced = false);
+	// разбор текста [begin, end)
+	static std::vector<BigIrreducibleFraction> ParseText(const char* begin, const char* end, const bool& isTrustedReduced = false);
+private:
+	// минимальный размер куска в байтах, чтобы не делить маленький текст между потоками
+	static const std::size_t minimalChunkSize = 1 << 16;
+	// разбор куска текста, который начинается с начала строки и заканчивается концом строки
+	static void ParseChunk(const char* begin, const char* end, const bool& isTrustedReduced, std::vector<BigIrreducibleFraction>& result);
+	// разбор одной строки без пробелов по краям
+	static BigIrreducibleFraction ParseLine(const char* begin, const char* end, const bool& isTrustedReduced);
+	// проверка, что [begin, end) - целое число с необязательным минусом
+	static bool IsInteger(const char* begin, const char* end);
+};
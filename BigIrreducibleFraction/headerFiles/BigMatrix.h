@@ -0,0 +1,47 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <BigIrreducibleFraction.h>
+#include <ParallelExecution.h>
+#include <stdexcept>
+
+// матрица из BigIrreducibleFraction
+// определитель, решение систем и обратная матрица считаются методом Бареиса без дробей:
+// знаменатели строк сокращаются заранее, работа идет с BigInt, а несократимые дроби собираются только в конце
+class BIGINT_API BigMatrix {
+public:
+	BigMatrix();
+	// нулевая матрица размера rowsCount x columnsCount
+	BigMatrix(const std::size_t& rowsCount, const std::size_t& columnsCount);
+	// матрица из строк (все строки должны быть одной длины)
+	BigMatrix(const std::vector<std::vector<BigIrreducibleFraction>>& rows);
+	std::size_t GetRowsCount() const;
+	std::size_t GetColumnsCount() const;
+	BigIrreducibleFraction& operator()(const std::size_t& row, const std::size_t& column);
+	const BigIrreducibleFraction& operator()(const std::size_t& row, const std::size_t& column) const;
+	// определитель (матрица должна быть квадратной)
+	BigIrreducibleFraction GetDeterminant() const;
+	// решение системы this * x = rightSide (матрица должна быть квадратной и невырожденной)
+	std::vector<BigIrreducibleFraction> Solve(const std::vector<BigIrreducibleFraction>& rightSide) const;
+	// обратная матрица (матрица должна быть квадратной и невырожденной)
+	BigMatrix GetInverse() const;
+	friend BIGINT_API std::ostream& operator<<(std::ostream& os, const BigMatrix& matrix);
+private:
+	// размеры и элементы матрицы, хранящиеся построчно в одном векторе
+	std::size_t rowsCount;
+	std::size_t columnsCount;
+	std::vector<BigIrreducibleFraction> elements;
+	// минимальное количество строк на поток при параллельном обновлении строк
+	static const std::size_t parallelRowsChunkSize = 4;
+	// проверка квадратности матрицы
+	void CheckSquare() const;
+	// строит целочисленную матрицу [this | rightSide] (rightSideColumnsCount столбцов правой части), умножая каждую строку на НОК знаменателей строки
+	// rowMultipliers - множители строк
+	std::vector<BigInt> GetIntegerAugmentedMatrix(const std::vector<BigIrreducibleFraction>& rightSide, const std::size_t& rightSideColumnsCount, std::vector<BigInt>& rowMultipliers) const;
+	// прямой ход метода Бареиса над целочисленной матрицей size x width, хранящейся построчно
+	// возвращает false, если матрица вырождена; swapsSign - знак перестановки строк
+	static bool EliminateBareiss(std::vector<BigInt>& matrix, const std::size_t& size, const std::size_t& width, int& swapsSign);
+	// обратный ход без дробей для столбцов правой части после EliminateBareiss
+	// возвращает решения, домноженные на последний ведущий элемент (они целые по правилу Крамера)
+	static std::vector<BigInt> SubstituteBackward(std::vector<BigInt>& matrix, const std::size_t& size, const std::size_t& width);
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <BigIntSerialization.h>
+#include <BigIrreducibleFraction.h>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+// контрольные точки долгого вычисления: именованные числа, дроби и индексы итераций в журнале на диске
+// журнал только дописывается: Commit добавляет одну запись с изменившимися с прошлого Commit значениями,
+// поэтому контрольная точка стоит пропорционально изменениям, а не всему состоянию
+// при открытии журнал отображается в память и записи применяются по порядку, значения читаются
+// в двоичной записи BigIntSerialization без разбора десятичного текста
+// у каждой записи есть длина и контрольная сумма: запись, оборванная при аварии, отбрасывается и отрезается от файла,
+// вычисление продолжается с предыдущей контрольной точки
+// формат файла: "BIFCHKPT", версия (1 байт), затем записи: длина содержимого (4 байта), контрольная сумма FNV-1a (4 байта)
+// и содержимое: varint количество значений, каждое - вид (1 байт), varint длина имени, имя и значение
+// объект не потокобезопасен, один журнал должен открывать один процесс
+class BIGINT_API ComputationCheckpoint {
+public:
+	// открытие журнала path (создается, если его нет) с восстановлением последней целой контрольной точки
+	ComputationCheckpoint(const std::string& path);
+	~ComputationCheckpoint();
+	ComputationCheckpoint(const ComputationCheckpoint&) = delete;
+	ComputationCheckpoint& operator=(const ComputationCheckpoint&) = delete;
+	// были ли в журнале контрольные точки при открытии
+	bool IsResumed() const;
+	// количество записей в журнале
+	unsigned long long GetCheckpointsCount() const;
+	void SetNumber(const std::string& name, const BigInt& value);
+	void SetFraction(const std::string& name, const BigIrreducibleFraction& value);
+	void SetIndex(const std::string& name, const unsigned long long& value);
+	bool HasNumber(const std::string& name) const;
+	bool HasFraction(const std::string& name) const;
+	bool HasIndex(const std::string& name) const;
+	// значение по имени, для отсутствующего - std::out_of_range
+	const BigInt& GetNumber(const std::string& name) const;
+	const BigIrreducibleFraction& GetFraction(const std::string& name) const;
+	unsigned long long GetIndex(const std::string& name) const;
+	// запись изменений одной записью журнала с синхронизацией на диск (без изменений ничего не пишется)
+	void Commit();
+	// замена журнала одной записью с полным состоянием: пишется временный файл, который переименовывается поверх журнала
+	void Compact();
+private:
+	enum class ValueKind : unsigned char {
+		Number,
+		Fraction,
+		Index
+	};
+	static const std::size_t recordHeaderSize = 8;
+	std::string path;
+	std::map<std::string, BigInt> numbers;
+	std::map<std::string, BigIrreducibleFraction> fractions;
+	std::map<std::string, unsigned long long> indices;
+	// имена значений, измененных с прошлого Commit
+	std::set<std::string> changedNumbers;
+	std::set<std::string> changedFractions;
+	std::set<std::string> changedIndices;
+	unsigned long long checkpointsCount;
+	bool isResumed;
+	// дескриптор журнала, открытого на дописывание (-1 без POSIX: тогда файл открывается при каждой записи)
+	int fileDescriptor;
+	// применение записей из [begin, end), возвращает длину целой части журнала
+	std::size_t Load(const char* begin, const char* end);
+	void ApplyRecord(const char* begin, const char* end);
+	// содержимое записи из значений с именами names каждого вида
+	std::string GetRecord(const std::set<std::string>& numberNames, const std::set<std::string>& fractionNames, const std::set<std::string>& indexNames) const;
+	void Append(const std::string& data);
+	static std::string GetFileHeader();
+	static unsigned GetChecksum(const char* begin, const char* end);
+	static unsigned ReadUnsigned(const char* position);
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <BigIrreducibleFraction.h>
+#include <stdexcept>
+#include <string>
+
+enum class ExpressionSyntax {
+	// обычная запись: целые числа, + - * /, унарные + и -, скобки и целая степень ^
+	// ^ правоассоциативна и старше унарного минуса (-2^2 = -4)
+	Infix,
+	// обратная польская запись: токены через пробелы - числа (целые или p/q), + - * / ^ и neg (смена знака)
+	ReversePolish
+};
+
+// вычисление рациональных выражений над BigIrreducibleFraction
+// ошибка записи выражения - std::invalid_argument с позицией, деление на ноль и ноль в отрицательной степени - std::domain_error
+// степень, результат которой длиннее maxResultDigitsCount цифр, не считается (std::invalid_argument), чтобы одна строка не заняла всю память
+class BIGINT_API ExpressionEvaluator {
+public:
+	static BigIrreducibleFraction Evaluate(const std::string& expression, const ExpressionSyntax& syntax);
+	static BigIrreducibleFraction Evaluate(const char* begin, const char* end, const ExpressionSyntax& syntax);
+private:
+	// наибольшая вложенность скобок и унарных операций, чтобы рекурсивный спуск не переполнил стек
+	static const unsigned maxDepth = 1000;
+	// наибольшая оценка длины результата степени в десятичных цифрах
+	static const unsigned long long maxResultDigitsCount = 1000000;
+	// разбор обычной записи рекурсивным спуском, position - первый неразобранный символ
+	static BigIrreducibleFraction ParseSum(const char* begin, const char*& position, const char* end, const unsigned& depth);
+	static BigIrreducibleFraction ParseProduct(const char* begin, const char*& position, const char* end, const unsigned& depth);
+	static BigIrreducibleFraction ParseUnary(const char* begin, const char*& position, const char* end, const unsigned& depth);
+	static BigIrreducibleFraction ParsePrimary(const char* begin, const char*& position, const char* end, const unsigned& depth);
+	static BigIrreducibleFraction EvaluateReversePolish(const char* begin, const char* end);
+	static BigIrreducibleFraction GetQuotient(const BigIrreducibleFraction& dividend, const BigIrreducibleFraction& divisor);
+	// степень с целым показателем (exponent - дробь со знаменателем 1), для отрицательного показателя - степень обратной дроби
+	static BigIrreducibleFraction GetPower(const BigIrreducibleFraction& base, const BigIrreducibleFraction& exponent);
+	// десятичный логарифм модуля ненулевого числа по его старшим цифрам
+	static double GetLogarithm(const BigInt& num);
+	static void SkipSpaces(const char*& position, const char* end);
+	static std::invalid_argument GetError(const std::string& message, const char* begin, const char* position);
+};
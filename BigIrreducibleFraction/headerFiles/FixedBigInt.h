@@ -0,0 +1,500 @@
+#pragma once
+
+#include <BigInt.h>
+#include <BigIntExport.h>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// исключение, которым FixedBigInt сообщает, что результат не помещается в Bits бит
+class BIGINT_API FixedBigIntOverflowException : public std::overflow_error {
+public:
+	FixedBigIntOverflowException(const std::string& reason);
+};
+
+// целое число со знаком ширины Bits бит (дополнительный код) целиком на стеке, без выделения памяти
+// для задач с известной границей размера (например, 256- или 512-битные дроби) заменяет BigInt с тем же набором операций
+// число хранится в Bits / 32 словах, циклы по словам имеют постоянную длину и разворачиваются компилятором
+// при переполнении операторы бросают FixedBigIntOverflowException, а методы Try* возвращают false;
+// ToBigInt переводит число в BigInt, чтобы продолжить вычисление без ограничения размера
+template <std::size_t Bits>
+class FixedBigInt {
+	static_assert((Bits % 32 == 0) && (Bits >= 64), "FixedBigInt: Bits must be a multiple of 32 and at least 64");
+public:
+	FixedBigInt();
+	FixedBigInt(const long long& inputNum);
+	// конструкторы из строки и BigInt бросают FixedBigIntOverflowException, если число не помещается
+	FixedBigInt(const std::string& inputNum);
+	explicit FixedBigInt(const BigInt& num);
+	friend FixedBigInt operator+(const FixedBigInt& summand1, const FixedBigInt& summand2) {
+		return FixedBigInt::GetChecked(FixedBigInt::TryGetSum, summand1, summand2);
+	}
+	friend FixedBigInt operator-(const FixedBigInt& minuend, const FixedBigInt& subtrahend) {
+		return FixedBigInt::GetChecked(FixedBigInt::TryGetDifference, minuend, subtrahend);
+	}
+	friend FixedBigInt operator*(const FixedBigInt& multiplier1, const FixedBigInt& multiplier2) {
+		return FixedBigInt::GetChecked(FixedBigInt::TryGetProduct, multiplier1, multiplier2);
+	}
+	// деление с округлением к нулю, остаток имеет знак делимого (как у BigInt)
+	friend FixedBigInt operator/(const FixedBigInt& dividend, const FixedBigInt& divisor) {
+		FixedBigInt quotient, remainder;
+		FixedBigInt::GetQuotientAndRemainder(dividend, divisor, quotient, remainder);
+		return quotient;
+	}
+	friend FixedBigInt operator%(const FixedBigInt& dividend, const FixedBigInt& divisor) {
+		return FixedBigInt::GetRemainder(dividend, divisor);
+	}
+	FixedBigInt& operator+=(const FixedBigInt& summand);
+	FixedBigInt& operator-=(const FixedBigInt& subtrahend);
+	FixedBigInt& operator*=(const FixedBigInt& multiplier);
+	FixedBigInt& operator/=(const FixedBigInt& divisor);
+	FixedBigInt& operator%=(const FixedBigInt& divisor);
+	FixedBigInt& operator++();
+	FixedBigInt& operator--();
+	FixedBigInt operator++(int);
+	FixedBigInt operator--(int);
+	FixedBigInt operator+() const;
+	FixedBigInt operator-() const;
+	friend bool operator==(const FixedBigInt& num1, const FixedBigInt& num2) noexcept {
+		return num1.limbs == num2.limbs;
+	}
+	friend bool operator!=(const FixedBigInt& num1, const FixedBigInt& num2) noexcept {
+		return num1.limbs != num2.limbs;
+	}
+	friend bool operator>(const FixedBigInt& num1, const FixedBigInt& num2) noexcept {
+		return FixedBigInt::GetCompareResult(num1, num2) > 0;
+	}
+	friend bool operator>=(const FixedBigInt& num1, const FixedBigInt& num2) noexcept {
+		return FixedBigInt::GetCompareResult(num1, num2) >= 0;
+	}
+	friend bool operator<(const FixedBigInt& num1, const FixedBigInt& num2) noexcept {
+		return FixedBigInt::GetCompareResult(num1, num2) < 0;
+	}
+	friend bool operator<=(const FixedBigInt& num1, const FixedBigInt& num2) noexcept {
+		return FixedBigInt::GetCompareResult(num1, num2) <= 0;
+	}
+	friend std::ostream& operator<<(std::ostream& os, const FixedBigInt& num) {
+		return os << num.ToString();
+	}
+	bool IsNegative() const noexcept;
+	std::string ToString() const;
+	// то же число без ограничения размера
+	BigInt ToBigInt() const;
+	// операции без исключений: false, если результат не помещается (result тогда не меняется)
+	static bool TryGetSum(const FixedBigInt& summand1, const FixedBigInt& summand2, FixedBigInt& result) noexcept;
+	static bool TryGetDifference(const FixedBigInt& minuend, const FixedBigInt& subtrahend, FixedBigInt& result) noexcept;
+	static bool TryGetProduct(const FixedBigInt& multiplier1, const FixedBigInt& multiplier2, FixedBigInt& result) noexcept;
+	// частное и остаток за одно деление (divisor != 0)
+	static void GetQuotientAndRemainder(const FixedBigInt& dividend, const FixedBigInt& divisor, FixedBigInt& quotient, FixedBigInt& remainder);
+	// наибольший общий делитель модулей чисел (алгоритм Евклида)
+	static FixedBigInt GetGreatestCommonDivisor(const FixedBigInt& num1, const FixedBigInt& num2);
+private:
+	static const std::size_t limbsCount = Bits / 32;
+	typedef std::array<std::uint32_t, limbsCount> Limbs;
+	// слова числа в дополнительном коде, младшие первыми
+	Limbs limbs;
+	// сравнение (1 -> больше; 0 -> равно; -1 -> меньше)
+	static int GetCompareResult(const FixedBigInt& num1, const FixedBigInt& num2) noexcept;
+	// результат операции Try*, при переполнении - исключение
+	// остаток помещается всегда, в том числе когда частное не помещается
+	static FixedBigInt GetRemainder(const FixedBigInt& dividend, const FixedBigInt& divisor);
+	template <typename Operation>
+	static FixedBigInt GetChecked(Operation operation, const FixedBigInt& num1, const FixedBigInt& num2);
+	// работа с модулями чисел как с беззнаковыми массивами слов
+	// модуль числа (помещается в Bits бит и для наименьшего отрицательного числа)
+	static Limbs GetMagnitude(const FixedBigInt& num) noexcept;
+	// число из модуля и знака, false если оно не помещается в диапазон со знаком
+	static bool TrySetMagnitude(const Limbs& magnitude, const bool& isNegative, FixedBigInt& result) noexcept;
+	static void Negate(Limbs& num) noexcept;
+	// количество слов без старших нулевых
+	static std::size_t GetSignificantLimbsCount(const Limbs& num) noexcept;
+	// num = num * multiplier + addend, возвращает перенос за старшее слово
+	static std::uint32_t MultiplyAdd(Limbs& num, const std::uint32_t& multiplier, const std::uint32_t& addend) noexcept;
+	// num = num / divisor, возвращает остаток
+	static std::uint32_t DivideBySmall(Limbs& num, const std::uint32_t& divisor) noexcept;
+	// деление модулей столбиком по словам (алгоритм D Кнута), divisor != 0
+	static void DivideMagnitudes(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder) noexcept;
+	// число из десятичных цифр [begin, end), без знака
+	static bool TryParseMagnitude(const char* begin, const char* end, Limbs& magnitude) noexcept;
+};
+
+template <std::size_t Bits>
+FixedBigInt<Bits>::FixedBigInt() : limbs() {
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>::FixedBigInt(const long long& inputNum) {
+	// long long занимает два слова, остальные заполняются знаком
+	unsigned long long value = static_cast<unsigned long long>(inputNum);
+	limbs[0] = static_cast<std::uint32_t>(value);
+	limbs[1] = static_cast<std::uint32_t>(value >> 32);
+	for (std::size_t i = 2; i < limbsCount; ++i)
+		limbs[i] = (inputNum < 0 ? 0xFFFFFFFFu : 0);
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>::FixedBigInt(const std::string& inputNum) {
+	bool isNegative = ((inputNum.length() != 0) && (inputNum[0] == '-'));
+	Limbs magnitude;
+	if (!TryParseMagnitude(inputNum.data() + (isNegative ? 1 : 0), inputNum.data() + inputNum.length(), magnitude) || !TrySetMagnitude(magnitude, isNegative, *this))
+		throw FixedBigIntOverflowException("FixedBigInt: number does not fit");
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>::FixedBigInt(const BigInt& num) {
+	// цифры BigInt переводятся в слова по 9 штук, без промежуточной строки
+	const std::vector<int>& digits = num.reversedNumberAbsoluteValue;
+	Limbs magnitude = Limbs();
+	bool isFitting = true;
+	for (std::size_t end = digits.size(); (end > 0) && isFitting;) {
+		std::size_t begin = (end > 9 ? end - 9 : 0);
+		std::uint32_t multiplier = 1, chunk = 0;
+		for (std::size_t i = end; i-- > begin;) {
+			multiplier *= 10;
+			chunk = chunk * 10 + digits[i];
+		}
+		isFitting = (MultiplyAdd(magnitude, multiplier, chunk) == 0);
+		end = begin;
+	}
+	if (!isFitting || !TrySetMagnitude(magnitude, num.isNegative, *this))
+		throw FixedBigIntOverflowException("FixedBigInt: number does not fit");
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>& FixedBigInt<Bits>::operator+=(const FixedBigInt& summand) {
+	return *this = *this + summand;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>& FixedBigInt<Bits>::operator-=(const FixedBigInt& subtrahend) {
+	return *this = *this - subtrahend;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>& FixedBigInt<Bits>::operator*=(const FixedBigInt& multiplier) {
+	return *this = *this * multiplier;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>& FixedBigInt<Bits>::operator/=(const FixedBigInt& divisor) {
+	return *this = *this / divisor;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>& FixedBigInt<Bits>::operator%=(const FixedBigInt& divisor) {
+	return *this = *this % divisor;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>& FixedBigInt<Bits>::operator++() {
+	return *this = *this + 1;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits>& FixedBigInt<Bits>::operator--() {
+	return *this = *this - 1;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits> FixedBigInt<Bits>::operator++(int) {
+	FixedBigInt temp = *this;
+	++*this;
+	return temp;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits> FixedBigInt<Bits>::operator--(int) {
+	FixedBigInt temp = *this;
+	--*this;
+	return temp;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits> FixedBigInt<Bits>::operator+() const {
+	return *this;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits> FixedBigInt<Bits>::operator-() const {
+	return FixedBigInt() - *this;
+}
+template <std::size_t Bits>
+bool FixedBigInt<Bits>::IsNegative() const noexcept {
+	return (limbs[limbsCount - 1] >> 31) != 0;
+}
+template <std::size_t Bits>
+std::string FixedBigInt<Bits>::ToString() const {
+	// модуль делится на 10^9, остатки дают цифры с младших
+	Limbs magnitude = GetMagnitude(*this);
+	std::string reversedDigits;
+	do {
+		std::uint32_t chunk = DivideBySmall(magnitude, 1000000000u);
+		bool isLastChunk = (GetSignificantLimbsCount(magnitude) == 0);
+		for (int i = 0; (i < 9) && (!isLastChunk || (chunk != 0) || (i == 0)); ++i) {
+			reversedDigits.push_back(static_cast<char>('0' + chunk % 10));
+			chunk /= 10;
+		}
+	} while (GetSignificantLimbsCount(magnitude) != 0);
+	if (IsNegative())
+		reversedDigits.push_back('-');
+	return std::string(reversedDigits.rbegin(), reversedDigits.rend());
+}
+template <std::size_t Bits>
+BigInt FixedBigInt<Bits>::ToBigInt() const {
+	Limbs magnitude = GetMagnitude(*this);
+	std::vector<int> reversedDigits;
+	reversedDigits.reserve(Bits / 3 + 9);
+	while (GetSignificantLimbsCount(magnitude) != 0) {
+		std::uint32_t chunk = DivideBySmall(magnitude, 1000000000u);
+		for (int i = 0; i < 9; ++i) {
+			reversedDigits.push_back(chunk % 10);
+			chunk /= 10;
+		}
+	}
+	if (reversedDigits.empty())
+		reversedDigits.push_back(0);
+	return BigInt(std::move(reversedDigits), IsNegative());
+}
+template <std::size_t Bits>
+bool FixedBigInt<Bits>::TryGetSum(const FixedBigInt& summand1, const FixedBigInt& summand2, FixedBigInt& result) noexcept {
+	FixedBigInt sum;
+	std::uint64_t carry = 0;
+	for (std::size_t i = 0; i < limbsCount; ++i) {
+		carry += static_cast<std::uint64_t>(summand1.limbs[i]) + summand2.limbs[i];
+		sum.limbs[i] = static_cast<std::uint32_t>(carry);
+		carry >>= 32;
+	}
+	// переполнение: слагаемые одного знака, а сумма другого
+	if ((summand1.IsNegative() == summand2.IsNegative()) && (sum.IsNegative() != summand1.IsNegative()))
+		return false;
+	result = sum;
+	return true;
+}
+template <std::size_t Bits>
+bool FixedBigInt<Bits>::TryGetDifference(const FixedBigInt& minuend, const FixedBigInt& subtrahend, FixedBigInt& result) noexcept {
+	FixedBigInt difference;
+	std::uint64_t borrow = 0;
+	for (std::size_t i = 0; i < limbsCount; ++i) {
+		std::uint64_t value = static_cast<std::uint64_t>(minuend.limbs[i]) - subtrahend.limbs[i] - borrow;
+		difference.limbs[i] = static_cast<std::uint32_t>(value);
+		borrow = (value >> 63);
+	}
+	// переполнение: числа разных знаков, а знак разности не совпадает со знаком уменьшаемого
+	if ((minuend.IsNegative() != subtrahend.IsNegative()) && (difference.IsNegative() != minuend.IsNegative()))
+		return false;
+	result = difference;
+	return true;
+}
+template <std::size_t Bits>
+bool FixedBigInt<Bits>::TryGetProduct(const FixedBigInt& multiplier1, const FixedBigInt& multiplier2, FixedBigInt& result) noexcept {
+	Limbs magnitude1 = GetMagnitude(multiplier1), magnitude2 = GetMagnitude(multiplier2);
+	std::size_t size1 = GetSignificantLimbsCount(magnitude1), size2 = GetSignificantLimbsCount(magnitude2);
+	// произведение модулей занимает не больше size1 + size2 слов
+	if (size1 + size2 > limbsCount + 1)
+		return false;
+	std::array<std::uint32_t, limbsCount + 1> product = std::array<std::uint32_t, limbsCount + 1>();
+	for (std::size_t i = 0; i < size1; ++i) {
+		std::uint64_t carry = 0;
+		for (std::size_t j = 0; j < size2; ++j) {
+			carry += static_cast<std::uint64_t>(magnitude1[i]) * magnitude2[j] + product[i + j];
+			product[i + j] = static_cast<std::uint32_t>(carry);
+			carry >>= 32;
+		}
+		product[i + size2] = static_cast<std::uint32_t>(carry);
+	}
+	if (product[limbsCount] != 0)
+		return false;
+	Limbs productMagnitude;
+	for (std::size_t i = 0; i < limbsCount; ++i)
+		productMagnitude[i] = product[i];
+	return TrySetMagnitude(productMagnitude, multiplier1.IsNegative() != multiplier2.IsNegative(), result);
+}
+template <std::size_t Bits>
+void FixedBigInt<Bits>::GetQuotientAndRemainder(const FixedBigInt& dividend, const FixedBigInt& divisor, FixedBigInt& quotient, FixedBigInt& remainder) {
+	Limbs divisorMagnitude = GetMagnitude(divisor);
+	if (GetSignificantLimbsCount(divisorMagnitude) == 0)
+		throw std::domain_error("FixedBigInt: division by zero");
+	Limbs quotientMagnitude, remainderMagnitude;
+	DivideMagnitudes(GetMagnitude(dividend), divisorMagnitude, quotientMagnitude, remainderMagnitude);
+	// частное не помещается только при делении наименьшего числа на -1
+	FixedBigInt newQuotient;
+	if (!TrySetMagnitude(quotientMagnitude, dividend.IsNegative() != divisor.IsNegative(), newQuotient))
+		throw FixedBigIntOverflowException("FixedBigInt: quotient does not fit");
+	TrySetMagnitude(remainderMagnitude, dividend.IsNegative(), remainder);
+	quotient = newQuotient;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits> FixedBigInt<Bits>::GetGreatestCommonDivisor(const FixedBigInt& num1, const FixedBigInt& num2) {
+	Limbs remainder1 = GetMagnitude(num1), remainder2 = GetMagnitude(num2);
+	while (GetSignificantLimbsCount(remainder2) != 0) {
+		Limbs quotient, remainder;
+		DivideMagnitudes(remainder1, remainder2, quotient, remainder);
+		remainder1 = remainder2;
+		remainder2 = remainder;
+	}
+	// НОД наименьшего числа и 0 (или его самого) равен 2^(Bits - 1) и не помещается
+	FixedBigInt result;
+	if (!TrySetMagnitude(remainder1, false, result))
+		throw FixedBigIntOverflowException("FixedBigInt: greatest common divisor does not fit");
+	return result;
+}
+
+template <std::size_t Bits>
+int FixedBigInt<Bits>::GetCompareResult(const FixedBigInt& num1, const FixedBigInt& num2) noexcept {
+	if (num1.IsNegative() != num2.IsNegative())
+		return (num1.IsNegative() ? -1 : 1);
+	// при одинаковом знаке дополнительный код сравнивается как беззнаковое число
+	for (std::size_t i = limbsCount; i-- > 0;)
+		if (num1.limbs[i] != num2.limbs[i])
+			return (num1.limbs[i] > num2.limbs[i] ? 1 : -1);
+	return 0;
+}
+template <std::size_t Bits>
+FixedBigInt<Bits> FixedBigInt<Bits>::GetRemainder(const FixedBigInt& dividend, const FixedBigInt& divisor) {
+	Limbs divisorMagnitude = GetMagnitude(divisor);
+	if (GetSignificantLimbsCount(divisorMagnitude) == 0)
+		throw std::domain_error("FixedBigInt: division by zero");
+	Limbs quotientMagnitude, remainderMagnitude;
+	DivideMagnitudes(GetMagnitude(dividend), divisorMagnitude, quotientMagnitude, remainderMagnitude);
+	FixedBigInt remainder;
+	TrySetMagnitude(remainderMagnitude, dividend.IsNegative(), remainder);
+	return remainder;
+}
+template <std::size_t Bits>
+template <typename Operation>
+FixedBigInt<Bits> FixedBigInt<Bits>::GetChecked(Operation operation, const FixedBigInt& num1, const FixedBigInt& num2) {
+	FixedBigInt result;
+	if (!operation(num1, num2, result))
+		throw FixedBigIntOverflowException("FixedBigInt: result does not fit");
+	return result;
+}
+template <std::size_t Bits>
+typename FixedBigInt<Bits>::Limbs FixedBigInt<Bits>::GetMagnitude(const FixedBigInt& num) noexcept {
+	Limbs magnitude = num.limbs;
+	if (num.IsNegative())
+		Negate(magnitude);
+	return magnitude;
+}
+template <std::size_t Bits>
+bool FixedBigInt<Bits>::TrySetMagnitude(const Limbs& magnitude, const bool& isNegative, FixedBigInt& result) noexcept {
+	// неотрицательное число меньше 2^(Bits - 1), отрицательное - не больше по модулю
+	if ((magnitude[limbsCount - 1] >> 31) != 0) {
+		if (!isNegative || (magnitude[limbsCount - 1] != 0x80000000u))
+			return false;
+		for (std::size_t i = 0; i + 1 < limbsCount; ++i)
+			if (magnitude[i] != 0)
+				return false;
+	}
+	result.limbs = magnitude;
+	if (isNegative)
+		Negate(result.limbs);
+	return true;
+}
+template <std::size_t Bits>
+void FixedBigInt<Bits>::Negate(Limbs& num) noexcept {
+	std::uint64_t carry = 1;
+	for (std::size_t i = 0; i < limbsCount; ++i) {
+		carry += static_cast<std::uint32_t>(~num[i]);
+		num[i] = static_cast<std::uint32_t>(carry);
+		carry >>= 32;
+	}
+}
+template <std::size_t Bits>
+std::size_t FixedBigInt<Bits>::GetSignificantLimbsCount(const Limbs& num) noexcept {
+	std::size_t count = limbsCount;
+	while ((count > 0) && (num[count - 1] == 0))
+		--count;
+	return count;
+}
+template <std::size_t Bits>
+std::uint32_t FixedBigInt<Bits>::MultiplyAdd(Limbs& num, const std::uint32_t& multiplier, const std::uint32_t& addend) noexcept {
+	std::uint64_t carry = addend;
+	for (std::size_t i = 0; i < limbsCount; ++i) {
+		carry += static_cast<std::uint64_t>(num[i]) * multiplier;
+		num[i] = static_cast<std::uint32_t>(carry);
+		carry >>= 32;
+	}
+	return static_cast<std::uint32_t>(carry);
+}
+template <std::size_t Bits>
+std::uint32_t FixedBigInt<Bits>::DivideBySmall(Limbs& num, const std::uint32_t& divisor) noexcept {
+	std::uint64_t remainder = 0;
+	for (std::size_t i = limbsCount; i-- > 0;) {
+		remainder = (remainder << 32) | num[i];
+		num[i] = static_cast<std::uint32_t>(remainder / divisor);
+		remainder %= divisor;
+	}
+	return static_cast<std::uint32_t>(remainder);
+}
+template <std::size_t Bits>
+void FixedBigInt<Bits>::DivideMagnitudes(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder) noexcept {
+	std::size_t dividendSize = GetSignificantLimbsCount(dividend), divisorSize = GetSignificantLimbsCount(divisor);
+	quotient = Limbs();
+	remainder = Limbs();
+	if (dividendSize < divisorSize) {
+		remainder = dividend;
+		return;
+	}
+	if (divisorSize == 1) {
+		quotient = dividend;
+		remainder[0] = DivideBySmall(quotient, divisor[0]);
+		return;
+	}
+	// нормализация: старший бит делителя становится единицей, тогда оценка цифры частного ошибается не больше чем на 2
+	unsigned shift = 0;
+	while ((divisor[divisorSize - 1] << shift) < 0x80000000u)
+		++shift;
+	std::array<std::uint32_t, limbsCount + 1> normalizedDividend = std::array<std::uint32_t, limbsCount + 1>();
+	Limbs normalizedDivisor = Limbs();
+	for (std::size_t i = 0; i < limbsCount; ++i) {
+		std::uint64_t dividendPart = static_cast<std::uint64_t>(dividend[i]) << shift;
+		normalizedDividend[i] |= static_cast<std::uint32_t>(dividendPart);
+		normalizedDividend[i + 1] = static_cast<std::uint32_t>(dividendPart >> 32);
+		std::uint64_t divisorPart = static_cast<std::uint64_t>(divisor[i]) << shift;
+		normalizedDivisor[i] |= static_cast<std::uint32_t>(divisorPart);
+		if (i + 1 < limbsCount)
+			normalizedDivisor[i + 1] = static_cast<std::uint32_t>(divisorPart >> 32);
+	}
+	const std::uint64_t base = 0x100000000ull;
+	for (std::size_t j = dividendSize - divisorSize + 1; j-- > 0;) {
+		// оценка цифры частного по двум старшим словам остатка
+		std::uint64_t top = (static_cast<std::uint64_t>(normalizedDividend[j + divisorSize]) << 32) | normalizedDividend[j + divisorSize - 1];
+		std::uint64_t quotientDigit = top / normalizedDivisor[divisorSize - 1];
+		std::uint64_t remainderDigit = top % normalizedDivisor[divisorSize - 1];
+		while ((quotientDigit >= base) || (quotientDigit * normalizedDivisor[divisorSize - 2] > ((remainderDigit << 32) | normalizedDividend[j + divisorSize - 2]))) {
+			--quotientDigit;
+			remainderDigit += normalizedDivisor[divisorSize - 1];
+			if (remainderDigit >= base)
+				break;
+		}
+		// вычитание делителя, умноженного на цифру
+		std::int64_t borrow = 0;
+		for (std::size_t i = 0; i < divisorSize; ++i) {
+			std::uint64_t product = quotientDigit * normalizedDivisor[i];
+			std::int64_t value = static_cast<std::int64_t>(normalizedDividend[i + j]) - borrow - static_cast<std::int64_t>(product & 0xFFFFFFFFull);
+			normalizedDividend[i + j] = static_cast<std::uint32_t>(value);
+			borrow = static_cast<std::int64_t>(product >> 32) - (value >> 32);
+		}
+		std::int64_t topValue = static_cast<std::int64_t>(normalizedDividend[j + divisorSize]) - borrow;
+		normalizedDividend[j + divisorSize] = static_cast<std::uint32_t>(topValue);
+		// оценка оказалась больше на 1: делитель прибавляется обратно
+		if (topValue < 0) {
+			--quotientDigit;
+			std::uint64_t carry = 0;
+			for (std::size_t i = 0; i < divisorSize; ++i) {
+				carry += static_cast<std::uint64_t>(normalizedDividend[i + j]) + normalizedDivisor[i];
+				normalizedDividend[i + j] = static_cast<std::uint32_t>(carry);
+				carry >>= 32;
+			}
+			normalizedDividend[j + divisorSize] += static_cast<std::uint32_t>(carry);
+		}
+		quotient[j] = static_cast<std::uint32_t>(quotientDigit);
+	}
+	// остаток - младшие слова делимого, сдвинутые обратно
+	for (std::size_t i = 0; i < divisorSize; ++i)
+		remainder[i] = static_cast<std::uint32_t>(((static_cast<std::uint64_t>(normalizedDividend[i + 1]) << 32) | normalizedDividend[i]) >> shift);
+}
+template <std::size_t Bits>
+bool FixedBigInt<Bits>::TryParseMagnitude(const char* begin, const char* end, Limbs& magnitude) noexcept {
+	magnitude = Limbs();
+	// цифры добавляются по 9 штук: magnitude = magnitude * 10^k + следующие k цифр
+	while (begin != end) {
+		std::uint32_t multiplier = 1, chunk = 0;
+		for (int i = 0; (i < 9) && (begin != end); ++i, ++begin) {
+			multiplier *= 10;
+			chunk = chunk * 10 + (*begin - '0');
+		}
+		if (MultiplyAdd(magnitude, multiplier, chunk) != 0)
+			return false;
+	}
+	return true;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <FractionProtocol.h>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// кадры FractionProtocol поверх локального сокета (Unix domain socket), только для POSIX
+class BIGINT_API FractionSocket {
+public:
+	// подключение к серверу, при ошибке - std::runtime_error
+	static int Connect(const std::string& path);
+	static void Close(const int& socket);
+	// чтение содержимого следующего кадра, false - соединение закрыто; при ошибке протокола - std::runtime_error
+	static bool ReadFrame(const int& socket, std::string& payload);
+	// запись кадров целиком, false - соединение разорвано
+	static bool WriteFrame(const int& socket, const std::string& frame);
+};
+
+// клиент fractionServer: пакет запросов отправляется одним кадром, ответы собираются по id
+// вызовы одного клиента из разных потоков выполняются по очереди
+class BIGINT_API FractionClient {
+public:
+	FractionClient(const std::string& socketPath);
+	~FractionClient();
+	FractionClient(const FractionClient&) = delete;
+	FractionClient& operator=(const FractionClient&) = delete;
+	// выполнение пакета запросов (id назначаются клиентом), ответы в порядке запросов
+	std::vector<FractionResponse> Execute(const std::vector<FractionRequest>& requests);
+	// одиночные операции: ошибка сервера бросается как std::invalid_argument, std::domain_error,
+	// OperationCancelledException (истек срок) или std::runtime_error; deadlineMilliseconds = 0 - срок сервера по умолчанию
+	BigInt Calculate(const FractionServiceOperation& operation, const BigInt& num1, const BigInt& num2, const unsigned& deadlineMilliseconds = 0);
+	BigIrreducibleFraction Calculate(const FractionServiceOperation& operation, const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2,
+		const unsigned& deadlineMilliseconds = 0);
+	// сравнение (1 -> больше; 0 -> равно; -1 -> меньше)
+	int Compare(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2, const unsigned& deadlineMilliseconds = 0);
+	// ответ с ошибкой превращается в исключение
+	static void ThrowIfFailed(const FractionResponse& response);
+private:
+	int socket;
+	unsigned long long nextId;
+	std::mutex clientMutex;
+	FractionResponse ExecuteOne(const FractionServiceOperation& operation, const std::vector<BigInt>& operands, const unsigned& deadlineMilliseconds);
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <BigIntSerialization.h>
+#include <BigIrreducibleFraction.h>
+#include <OperationContext.h>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// протокол fractionServer: клиент шлет пакеты запросов, сервер отвечает пакетами ответов
+// каждый пакет - кадр: длина содержимого (4 байта, от младших) и содержимое
+// содержимое пакета запросов: varint количество, затем запросы: varint id, код операции (1 байт),
+// varint срок в миллисекундах от получения (0 - срок сервера по умолчанию) и операнды (BigIntSerialization)
+// содержимое пакета ответов: varint количество, затем ответы: varint id, статус (1 байт),
+// при Ok - varint количество результатов и числа, иначе varint длина и текст ошибки
+// ответы одного пакета запросов могут прийти в нескольких пакетах и в любом порядке, клиент сопоставляет их по id
+enum class FractionServiceOperation : unsigned char {
+	// операции BigInt: два операнда, один результат; у Power второй операнд - неотрицательный показатель
+	Sum,
+	Difference,
+	Product,
+	Quotient,
+	Remainder,
+	GreatestCommonDivisor,
+	Power,
+	// операции дробей: числитель и знаменатель каждой из двух дробей, результат - числитель и знаменатель
+	FractionSum,
+	FractionDifference,
+	FractionProduct,
+	FractionQuotient,
+	// результат сравнения - число -1, 0 или 1
+	FractionCompare,
+	// сокращение дроби: числитель и знаменатель
+	FractionReduction
+};
+
+enum class FractionServiceStatus : unsigned char {
+	Ok,
+	// неверные операнды (не то количество, нулевой знаменатель дроби, слишком большой результат степени)
+	InvalidArgument,
+	// деление на ноль
+	DomainError,
+	// срок запроса истек до или во время вычисления
+	DeadlineExceeded,
+	InternalError
+};
+
+struct FractionRequest {
+	unsigned long long id;
+	FractionServiceOperation operation;
+	unsigned deadlineMilliseconds;
+	std::vector<BigInt> operands;
+};
+
+struct FractionResponse {
+	unsigned long long id;
+	FractionServiceStatus status;
+	std::vector<BigInt> results;
+	std::string message;
+};
+
+class BIGINT_API FractionProtocol {
+public:
+	static const std::size_t operationsCount = (std::size_t)FractionServiceOperation::FractionReduction + 1;
+	// наибольший размер содержимого кадра, больший кадр считается ошибкой протокола
+	static const std::size_t maxFrameSize = 1 << 28;
+	static std::size_t GetOperandsCount(const FractionServiceOperation& operation);
+	// дописывание кадра целиком (с длиной) в frame
+	static void AppendRequests(std::string& frame, const std::vector<FractionRequest>& requests);
+	static void AppendResponses(std::string& frame, const std::vector<FractionResponse>& responses);
+	// разбор содержимого кадра (без длины), при ошибке - std::invalid_argument
+	static std::vector<FractionRequest> ParseRequests(const char* begin, const char* end);
+	static std::vector<FractionResponse> ParseResponses(const char* begin, const char* end);
+	// длина содержимого по 4 байтам заголовка кадра
+	static std::size_t GetFrameSize(const unsigned char* header);
+	// выполнение запроса в текущем потоке, исключения превращаются в статус ответа
+	// срок запроса проверяет OperationContext, привязанный к потоку вызывающим
+	static FractionResponse Execute(const FractionRequest& request);
+	// наибольшая оценка длины результата Power в десятичных цифрах (показатель, умноженный на логарифм основания),
+	// запрос с большим результатом отклоняется без вычисления
+	static void SetMaxResultDigitsCount(const unsigned long long& digitsCount);
+	static unsigned long long GetMaxResultDigitsCount();
+private:
+	static std::atomic<unsigned long long> maxResultDigitsCount;
+	static const std::size_t frameHeaderSize = 4;
+	static void BeginFrame(std::string& frame, std::size_t& headerPosition);
+	static void EndFrame(std::string& frame, const std::size_t& headerPosition);
+	// дробь из операндов запроса (знаменатель приводится к положительному)
+	static BigIrreducibleFraction GetFraction(const BigInt& numerator, const BigInt& denominator);
+	static std::vector<BigInt> GetResults(const FractionRequest& request);
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <atomic>
+#include <cstddef>
+
+// кэш хэша внутри объекта, 0 означает, что хэш еще не посчитан
+// копируется вместе с объектом; объект обязан вызывать Reset при изменении своего значения
+// чтение и запись атомарны, поэтому хэш можно считать из нескольких потоков без блокировок
+// при определенном BIG_INT_DISABLE_HASH_CACHE кэш ничего не хранит и хэш считается каждый раз
+class BIGINT_API HashCache {
+public:
+	HashCache();
+	HashCache(const HashCache& other);
+	HashCache& operator=(const HashCache& other);
+	// возвращает true и хэш, если он уже посчитан
+	bool TryGet(std::size_t& hash) const;
+	void Set(const std::size_t& hash) const;
+	void Reset();
+private:
+#ifndef BIG_INT_DISABLE_HASH_CACHE
+	mutable std::atomic<std::size_t> cachedHash;
+#endif
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <cstddef>
+#include <memory>
+
+// необязательные счетчики операций BigInt и BigIrreducibleFraction для профилирования
+// включаются макросом BIGINT_INSTRUMENTATION (опция CMake ENABLE_INSTRUMENTATION), без него макросы
+// BIGINT_INSTRUMENT_KERNEL и BIGINT_INSTRUMENT_ITERATION пусты и вычисления ничего не считают
+// по каждому ядру считаются вызовы, обработанные цифры операндов, итерации внутренних циклов (шаги деления, НОД, Ньютона)
+// и выделения памяти, которые сообщает AddAllocation и относит к самому внутреннему выполняющемуся ядру потока (или к Other вне ядер)
+// библиотека не заменяет глобальный operator new: программа, которой нужен подсчет выделений, сама компонует
+// sourceFiles/InstrumentationAllocation.cpp (так собираются benchmarkSuite, validationSuite и workloadReplay со счетчиками)
+// счетчики свои у каждого потока, GetSnapshot и Reset работают со счетчиками текущего потока;
+// работа задач пула потоков (например, параллельного Карацубы) считается у потока, добавившего задачу, и в том же ядре
+enum class InstrumentedKernel {
+	Sum,
+	Difference,
+	Product,
+	Quotient,
+	GreatestCommonDivisor,
+	Power,
+	Root,
+	FractionReduction,
+	Other
+};
+
+struct KernelCounters {
+	unsigned long long callsCount;
+	unsigned long long digitsCount;
+	unsigned long long iterationsCount;
+	unsigned long long allocationsCount;
+	unsigned long long allocatedBytes;
+};
+
+// копия счетчиков потока на момент вызова GetSnapshot
+struct BIGINT_API InstrumentationSnapshot {
+	static const std::size_t kernelsCount = (std::size_t)InstrumentedKernel::Other + 1;
+	KernelCounters kernels[kernelsCount];
+	const KernelCounters& Get(const InstrumentedKernel& kernel) const;
+};
+
+// счетчики, которые задачи пула добавляют к счетчикам добавившего их потока
+struct InstrumentationInbox;
+
+// состояние счетчиков потока, которое переходит к его задачам в пуле потоков (пусто в сборке без счетчиков)
+struct InstrumentationTaskState {
+	std::shared_ptr<InstrumentationInbox> inbox;
+	InstrumentedKernel kernel;
+};
+
+class BIGINT_API Instrumentation {
+public:
+	// собрана ли библиотека со счетчиками
+	static bool IsEnabled();
+	static InstrumentationSnapshot GetSnapshot();
+	static void Reset();
+	// название ядра для отчетов ("sum", "product", ...)
+	static const char* GetKernelName(const InstrumentedKernel& kernel);
+	static void AddCall(const InstrumentedKernel& kernel, const std::size_t& digitsCount);
+	static void AddIteration(const InstrumentedKernel& kernel);
+	static void AddAllocation(const std::size_t& bytes);
+	static InstrumentationTaskState GetTaskState();
+	friend class InstrumentationScope;
+	friend class InstrumentationTaskScope;
+private:
+	static thread_local InstrumentationSnapshot counters;
+	// счетчики задач этого потока, выполненных другими потоками (создаются при первой задаче)
+	static thread_local std::shared_ptr<InstrumentationInbox> inbox;
+	// ядро, к которому относятся выделения памяти текущего потока
+	static thread_local InstrumentedKernel currentKernel;
+};
+
+// считает вызов ядра и относит к нему выделения памяти до конца области
+class BIGINT_API InstrumentationScope {
+public:
+	InstrumentationScope(const InstrumentedKernel& kernel, const std::size_t& digitsCount);
+	~InstrumentationScope();
+	InstrumentationScope(const InstrumentationScope&) = delete;
+	InstrumentationScope& operator=(const InstrumentationScope&) = delete;
+private:
+	InstrumentedKernel previousKernel;
+};
+
+// на время выполнения задачи пула считает ее работу отдельно и затем добавляет к счетчикам добавившего ее потока
+class BIGINT_API InstrumentationTaskScope {
+public:
+	InstrumentationTaskScope(const InstrumentationTaskState& state);
+	~InstrumentationTaskScope();
+	InstrumentationTaskScope(const InstrumentationTaskScope&) = delete;
+	InstrumentationTaskScope& operator=(const InstrumentationTaskScope&) = delete;
+private:
+	std::shared_ptr<InstrumentationInbox> inbox;
+	InstrumentationSnapshot previousCounters;
+	InstrumentedKernel previousKernel;
+};
+
+#ifdef BIGINT_INSTRUMENTATION
+#define BIGINT_INSTRUMENT_KERNEL(kernel, digitsCount) InstrumentationScope instrumentationScope(InstrumentedKernel::kernel, (digitsCount))
+#define BIGINT_INSTRUMENT_ITERATION(kernel) Instrumentation::AddIteration(InstrumentedKernel::kernel)
+#else
+#define BIGINT_INSTRUMENT_KERNEL(kernel, digitsCount) ((void)0)
+#define BIGINT_INSTRUMENT_ITERATION(kernel) ((void)0)
+#endif
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// гистограммы задержек долгих операций и необязательная трассировка
+// включаются во время работы: пока выключены, замер операции - одна проверка атомарного флага, без чтения часов
+// гистограммы общие для всех потоков и ведутся по операции и классу размера (номер старшего бита количества цифр операндов),
+// корзины задержек логарифмические: в корзину i попадают задержки от 2^(i-1) до 2^i - 1 наносекунд
+// обработчик трассировки получает каждую замеренную операцию, ChromeTraceWriter пишет их в файл формата Chrome trace
+enum class TracedOperation {
+	Multiplication,
+	Division,
+	GreatestCommonDivisor,
+	FractionReduction
+};
+
+// одна замеренная операция
+struct TraceEvent {
+	TracedOperation operation;
+	std::size_t digitsCount;
+	// начало в наносекундах от эпохи steady_clock и длительность в наносекундах
+	unsigned long long startNanoseconds;
+	unsigned long long durationNanoseconds;
+	std::thread::id threadId;
+};
+
+// копия одной гистограммы
+struct BIGINT_API LatencyHistogram {
+	static const std::size_t bucketsCount = 48;
+	unsigned long long counts[bucketsCount];
+	// учет одной задержки в ее корзине, для гистограмм, которые ведет сам вызывающий
+	void Add(const unsigned long long& nanoseconds);
+	unsigned long long GetTotalCount() const;
+	// верхняя граница задержки (в наносекундах), не больше которой доля quantile операций (0 < quantile <= 1)
+	unsigned long long GetQuantileUpperBound(const double& quantile) const;
+	// номер корзины задержки
+	static std::size_t GetBucket(const unsigned long long& nanoseconds);
+};
+
+class BIGINT_API LatencyTracing {
+public:
+	static const std::size_t operationsCount = (std::size_t)TracedOperation::FractionReduction + 1;
+	static const std::size_t sizeClassesCount = 40;
+	static void SetHistogramsEnabled(const bool& isEnabled);
+	// обработчик вызывается в потоке, выполнившем операцию, пустой обработчик выключает трассировку
+	static void SetTraceCallback(const std::function<void(const TraceEvent&)>& callback);
+	static bool IsActive();
+	static LatencyHistogram GetHistogram(const TracedOperation& operation, const std::size_t& sizeClass);
+	static void ResetHistograms();
+	// класс размера для количества цифр: 0 для 0 и 1, иначе номер старшего бита
+	static std::size_t GetSizeClass(const std::size_t& digitsCount);
+	static const char* GetOperationName(const TracedOperation& operation);
+	static void Record(const TraceEvent& event);
+private:
+	static std::atomic<bool> isHistogramsEnabled;
+	static std::atomic<bool> isTracingEnabled;
+	static std::shared_ptr<const std::function<void(const TraceEvent&)>> traceCallback;
+	static std::atomic<unsigned long long> histograms[operationsCount][sizeClassesCount][LatencyHistogram::bucketsCount];
+};
+
+// замеряет операцию от создания до разрушения, если гистограммы или трассировка включены
+class BIGINT_API LatencyScope {
+public:
+	LatencyScope(const TracedOperation& operation, const std::size_t& digitsCount);
+	~LatencyScope();
+	LatencyScope(const LatencyScope&) = delete;
+	LatencyScope& operator=(const LatencyScope&) = delete;
+private:
+	TracedOperation operation;
+	std::size_t digitsCount;
+	bool isActive;
+	std::chrono::steady_clock::time_point start;
+};
+
+// запись событий в файл формата Chrome trace (открывается в chrome://tracing и Perfetto)
+// Write можно вызывать из многих потоков, файл закрывается в деструкторе
+class BIGINT_API ChromeTraceWriter {
+public:
+	ChromeTraceWriter(const std::string& path);
+	~ChromeTraceWriter();
+	ChromeTraceWriter(const ChromeTraceWriter&) = delete;
+	ChromeTraceWriter& operator=(const ChromeTraceWriter&) = delete;
+	void Write(const TraceEvent& event);
+	// обработчик для LatencyTracing::SetTraceCallback, пишущий в этот файл (писатель должен жить, пока обработчик установлен)
+	std::function<void(const TraceEvent&)> GetCallback();
+private:
+	std::ofstream output;
+	std::mutex outputMutex;
+	bool isFirstEvent;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <BigInt.h>
+#include <BigIntExport.h>
+#include <stdexcept>
+
+// арифметика по одному модулю, настроенная один раз при создании контекста
+// для модуля, взаимно простого с 10, используется умножение Монтгомери с R = 10^k (k - количество цифр модуля):
+// BigInt хранит десятичные цифры, поэтому остаток и частное от деления на R - это просто младшие и старшие цифры,
+// и вместо полного деления operator% каждое умножение стоит трех умножений чисел из k цифр
+// для остальных модулей (четных или делящихся на 5) контекст работает с обычными остатками через operator%
+// значения хранятся в форме контекста: ToForm переводит число в нее, FromForm - обратно;
+// MulMod, AddMod, SubMod, PowMod и Inverse принимают и возвращают значения в этой форме (от 0 до модуля - 1)
+// контекст после создания не меняется, поэтому его можно использовать из многих потоков одновременно
+class BIGINT_API ModContext {
+public:
+	// modulus > 1
+	ModContext(const BigInt& modulus);
+	const BigInt& GetModulus() const;
+	// используется ли умножение Монтгомери (модуль взаимно прост с 10)
+	bool IsMontgomery() const;
+	// перевод любого целого числа в форму контекста и обратно в остаток от 0 до модуля - 1
+	BigInt ToForm(const BigInt& num) const;
+	BigInt FromForm(const BigInt& num) const;
+	// единица в форме контекста
+	const BigInt& GetOne() const;
+	BigInt AddMod(const BigInt& summand1, const BigInt& summand2) const;
+	BigInt SubMod(const BigInt& minuend, const BigInt& subtrahend) const;
+	BigInt MulMod(const BigInt& multiplier1, const BigInt& multiplier2) const;
+	// возведение в неотрицательную степень (0^0 = 1), цифры показателя обрабатываются по одной, от старших
+	BigInt PowMod(const BigInt& base, const BigInt& exponent) const;
+	// обратный элемент по модулю (расширенный алгоритм Евклида), если его нет - std::domain_error
+	BigInt Inverse(const BigInt& num) const;
+private:
+	BigInt modulus;
+	bool isMontgomery;
+	// количество цифр модуля, R = 10^digitsCount
+	std::size_t digitsCount;
+	// -modulus^(-1) mod R
+	BigInt modulusNegativeInverse;
+	// R^2 mod modulus, умножение на него переводит число в форму Монтгомери
+	BigInt rSquared;
+	// единица в форме контекста (R mod modulus)
+	BigInt one;
+	// приведение произведения двух значений к форме контекста: REDC(num) = num * R^(-1) mod modulus или num % modulus
+	BigInt Reduce(const BigInt& num) const;
+	// num mod 10^count и num / 10^count для неотрицательного num
+	static BigInt GetLowDigits(const BigInt& num, const std::size_t& count);
+	static BigInt GetHighDigits(const BigInt& num, const std::size_t& count);
+	// обратный к num по модулю 10^count (num взаимно прост с 10), подъем Гензеля с удвоением точности
+	static BigInt GetInverseModPowerOfTen(const BigInt& num, const std::size_t& count);
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+// исключение, которым прерывается отмененная или просроченная операция
+class BIGINT_API OperationCancelledException : public std::runtime_error {
+public:
+	OperationCancelledException(const std::string& reason);
+};
+
+// состояние одной долгой операции: флаг отмены, срок выполнения и обработчик прогресса
+// контекст привязывается к потоку через OperationScope, а вычисления BigInt в этом потоке
+// периодически вызывают Checkpoint и бросают OperationCancelledException, если операцию отменили или срок истек
+// без привязанного контекста Checkpoint сводится к одной проверке указателя
+class BIGINT_API OperationContext {
+public:
+	OperationContext();
+	OperationContext(const OperationContext&) = delete;
+	OperationContext& operator=(const OperationContext&) = delete;
+	// отмена операции, может вызываться из любого потока
+	void Cancel();
+	bool IsCancelled() const;
+	// срок и обработчик прогресса задаются до запуска операции
+	void SetDeadline(const std::chrono::steady_clock::time_point& deadline);
+	// обработчик получает долю выполненной работы от 0 до 1 и вызывается в потоке, выполняющем операцию
+	void SetProgressCallback(const std::function<void(const double&)>& callback);
+	// контекст текущего потока (nullptr, если его нет)
+	static OperationContext* GetCurrent();
+	// проверка отмены и срока операции текущего потока
+	static void Checkpoint();
+	// сообщение о прогрессе операции текущего потока
+	// учитывается только от самого внешнего из вложенных ProgressScope, чтобы, например, деления внутри НОД не сбивали прогресс НОД
+	static void ReportProgress(const double& progress);
+	friend class OperationScope;
+	friend class ProgressScope;
+private:
+	std::atomic<bool> isCancelled;
+	bool hasDeadline;
+	std::chrono::steady_clock::time_point deadline;
+	std::function<void(const double&)> progressCallback;
+	// количество проверок, после которого снова смотрится время (часы дороже проверки флага)
+	static const unsigned deadlineCheckPeriod = 64;
+	static thread_local OperationContext* current;
+	static thread_local unsigned checkpointsCount;
+	static thread_local unsigned progressDepth;
+};
+
+// привязывает контекст к текущему потоку на время жизни объекта (nullptr - без контекста)
+// isProgressOwner - вычисления в этой области сообщают прогресс операции;
+// задачи, отданные в пул потоков, привязывают контекст породившего их потока без этого флага, прогресс сообщает сам поток
+class BIGINT_API OperationScope {
+public:
+	OperationScope(OperationContext* context, const bool& isProgressOwner = false);
+	~OperationScope();
+	OperationScope(const OperationScope&) = delete;
+	OperationScope& operator=(const OperationScope&) = delete;
+private:
+	OperationContext* previousContext;
+	unsigned previousProgressDepth;
+};
+
+// отмечает вычисление, которое сообщает свой прогресс через OperationContext::ReportProgress
+class BIGINT_API ProgressScope {
+public:
+	ProgressScope();
+	~ProgressScope();
+	ProgressScope(const ProgressScope&) = delete;
+	ProgressScope& operator=(const ProgressScope&) = delete;
+	// является ли вычисление самым внешним, то есть учитывается ли его прогресс
+	bool IsOutermost() const;
+private:
+	bool isOutermost;
+};
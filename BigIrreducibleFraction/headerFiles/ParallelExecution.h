@@ -0,0 +1,10 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <ThreadPool.h>
+#include <cstddef>
+#include <exception>
+
+// выполняет body(i) для всех i из [begin, end), распределяя индексы по потокам общего пула
+// minimalChunkSize - минимальное количество индексов на один поток, чтобы не раздавать потокам малую работу
+BIGINT_API void ParallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t)>& body, std::size_t minimalChunkSize = 1);
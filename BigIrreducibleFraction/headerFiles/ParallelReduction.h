@@ -0,0 +1,30 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <BigIrreducibleFraction.h>
+#include <ThreadPool.h>
+
+// сумма и произведение больших наборов дробей в общем пуле потоков
+// набор делится пополам до кусков из parallelLeafSize дробей, половины считаются параллельно, куски - деревом внутри потока;
+// каждая промежуточная дробь остается несократимой: НОД считается по знаменателям и перекрестным множителям (Хенричи),
+// а не по итоговому произведению, поэтому числа дерева растут как НОК знаменателей, а не как их произведение
+// форма дерева зависит только от количества дробей, а несократимая дробь единственна,
+// поэтому результат совпадает с последовательным += / *= при любом количестве потоков
+class BIGINT_API ParallelReduction {
+public:
+	// сумма дробей (0 для пустого набора)
+	static BigIrreducibleFraction GetSum(const std::vector<BigIrreducibleFraction>& fractions);
+	// произведение дробей (1 для пустого набора)
+	static BigIrreducibleFraction GetProduct(const std::vector<BigIrreducibleFraction>& fractions);
+private:
+	// количество дробей, начиная с которого половины набора считаются в разных задачах
+	static const std::size_t parallelLeafSize = 64;
+	// свертка дробей [begin, end) сбалансированным деревом
+	static BigIrreducibleFraction GetTreeResult(const BigIrreducibleFraction* begin, const BigIrreducibleFraction* end, const bool& isSum);
+	// сумма или произведение несократимых дробей без сокращения по полному произведению
+	static BigIrreducibleFraction GetCombined(const BigIrreducibleFraction& left, const BigIrreducibleFraction& right, const bool& isSum);
+};
+
+// сумма и произведение дробей через ParallelReduction
+BIGINT_API BigIrreducibleFraction ParallelSum(const std::vector<BigIrreducibleFraction>& fractions);
+BIGINT_API BigIrreducibleFraction ParallelProduct(const std::vector<BigIrreducibleFraction>& fractions);
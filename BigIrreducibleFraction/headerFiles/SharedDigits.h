@@ -0,0 +1,49 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <atomic>
+#include <vector>
+
+// цифры числа в общем буфере со счетчиком ссылок: копирование только увеличивает атомарный счетчик,
+// а буфер копируется при первом изменении, если им пользуется еще кто-то (копирование при записи)
+// чтение через константные методы не меняет буфер, поэтому одно число и его копии можно читать из многих потоков одновременно
+// счетчик ссылок свой, а не shared_ptr: проверка единственности буфера перед изменением читает счетчик с acquire,
+// а отпускание ссылки уменьшает его с release, поэтому чтения буфера другой копией завершаются до изменения на месте
+class BIGINT_API SharedDigits {
+public:
+	SharedDigits();
+	SharedDigits(const std::vector<int>& digits);
+	SharedDigits(std::vector<int>&& digits);
+	SharedDigits(const SharedDigits& other) noexcept;
+	SharedDigits(SharedDigits&& other) noexcept;
+	~SharedDigits();
+	SharedDigits& operator=(const SharedDigits& other) noexcept;
+	SharedDigits& operator=(SharedDigits&& other) noexcept;
+	SharedDigits& operator=(const std::vector<int>& digits);
+	SharedDigits& operator=(std::vector<int>&& digits);
+	// чтение
+	operator const std::vector<int>&() const;
+	const std::vector<int>& Get() const;
+	std::size_t size() const;
+	bool empty() const;
+	const int& operator[](const std::size_t& index) const;
+	// изменение (буфер копируется, если он общий)
+	void push_back(const int& digit);
+	void pop_back();
+	void clear();
+	void reserve(const std::size_t& size);
+private:
+	struct Buffer {
+		std::vector<int> digits;
+		std::atomic<std::size_t> referencesCount;
+		Buffer(std::vector<int>&& inDigits) : digits(std::move(inDigits)), referencesCount(1) {
+		}
+	};
+	// nullptr означает пустой вектор
+	Buffer* buffer;
+	// буфер, который можно менять: единственный для этого объекта
+	std::vector<int>& GetMutable();
+	bool IsUnique() const;
+	// отпускает ссылку на буфер, последняя ссылка удаляет его
+	void Release() noexcept;
+};
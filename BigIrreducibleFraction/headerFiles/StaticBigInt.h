@@ -0,0 +1,200 @@
+#pragma once
+
+#include <BigInt.h>
+#include <cstddef>
+#include <stdexcept>
+
+// целое число фиксированной емкости (Capacity десятичных цифр), с которым можно работать на этапе компиляции
+// константы записываются литералом _big: constexpr auto modulus = 1000000000000000000000007_big;
+// литерал разбирается компилятором, а объект constexpr лежит в данных только для чтения, поэтому при запуске ничего не разбирается
+// в BigInt число переводится копированием готовых цифр, без разбора строки
+// сложение, вычитание и умножение тоже constexpr, емкость результата достаточна, чтобы переполнения не было
+template <std::size_t Capacity>
+class StaticBigInt {
+public:
+	constexpr StaticBigInt();
+	// число из десятичных символов [begin, end) с необязательным минусом и разделителями '
+	constexpr StaticBigInt(const char* begin, const char* end);
+	constexpr std::size_t GetDigitsCount() const;
+	// цифра разряда index (0 - младший, за пределами числа - 0)
+	constexpr int GetDigit(const std::size_t& index) const;
+	constexpr bool IsNegative() const;
+	constexpr StaticBigInt operator-() const;
+	template <std::size_t OtherCapacity>
+	constexpr StaticBigInt<(Capacity > OtherCapacity ? Capacity : OtherCapacity) + 1> operator+(const StaticBigInt<OtherCapacity>& summand) const;
+	template <std::size_t OtherCapacity>
+	constexpr StaticBigInt<(Capacity > OtherCapacity ? Capacity : OtherCapacity) + 1> operator-(const StaticBigInt<OtherCapacity>& subtrahend) const;
+	template <std::size_t OtherCapacity>
+	constexpr StaticBigInt<Capacity + OtherCapacity> operator*(const StaticBigInt<OtherCapacity>& multiplier) const;
+	template <std::size_t OtherCapacity>
+	constexpr bool operator==(const StaticBigInt<OtherCapacity>& num) const;
+	template <std::size_t OtherCapacity>
+	constexpr bool operator!=(const StaticBigInt<OtherCapacity>& num) const;
+	template <std::size_t OtherCapacity>
+	constexpr bool operator<(const StaticBigInt<OtherCapacity>& num) const;
+	operator BigInt() const;
+	template <std::size_t OtherCapacity>
+	friend class StaticBigInt;
+private:
+	// цифры в обратном порядке, как в BigInt, без незначащих нулей (у нуля одна цифра)
+	int digits[Capacity];
+	std::size_t digitsCount;
+	bool isNegative;
+	// сравнение модулей (1 -> больше; 0 -> равно; -1 -> меньше)
+	template <std::size_t OtherCapacity>
+	constexpr int GetAbsoluteCompareResult(const StaticBigInt<OtherCapacity>& num) const;
+	// сумма this и num, взятого со знаком isNumNegative (для разности знак num меняется)
+	template <std::size_t OtherCapacity>
+	constexpr StaticBigInt<(Capacity > OtherCapacity ? Capacity : OtherCapacity) + 1> GetSignedSum(const StaticBigInt<OtherCapacity>& num, const bool& isNumNegative) const;
+	// удаление незначащих нулей и знака у нуля
+	constexpr void Normalize();
+};
+
+// литерал: 123_big, 1'000'000_big, -5_big (минус - унарный оператор)
+template <char... Chars>
+constexpr StaticBigInt<sizeof...(Chars)> operator""_big();
+
+template <std::size_t Capacity>
+constexpr StaticBigInt<Capacity>::StaticBigInt() : digits{}, digitsCount(1), isNegative(false) {
+}
+template <std::size_t Capacity>
+constexpr StaticBigInt<Capacity>::StaticBigInt(const char* begin, const char* end) : digits{}, digitsCount(0), isNegative(false) {
+	if ((begin != end) && (*begin == '-')) {
+		isNegative = true;
+		++begin;
+	}
+	for (const char* i = end; i != begin;) {
+		char symbol = *--i;
+		if (symbol == '\'')
+			continue;
+		if ((symbol < '0') || (symbol > '9') || (digitsCount == Capacity))
+			throw std::invalid_argument("StaticBigInt: literal must be a decimal integer");
+		digits[digitsCount++] = symbol - '0';
+	}
+	Normalize();
+}
+template <std::size_t Capacity>
+constexpr std::size_t StaticBigInt<Capacity>::GetDigitsCount() const {
+	return digitsCount;
+}
+template <std::size_t Capacity>
+constexpr int StaticBigInt<Capacity>::GetDigit(const std::size_t& index) const {
+	return (index < digitsCount ? digits[index] : 0);
+}
+template <std::size_t Capacity>
+constexpr bool StaticBigInt<Capacity>::IsNegative() const {
+	return isNegative;
+}
+template <std::size_t Capacity>
+constexpr StaticBigInt<Capacity> StaticBigInt<Capacity>::operator-() const {
+	StaticBigInt result = *this;
+	result.isNegative = !isNegative;
+	result.Normalize();
+	return result;
+}
+template <std::size_t Capacity>
+template <std::size_t OtherCapacity>
+constexpr StaticBigInt<(Capacity > OtherCapacity ? Capacity : OtherCapacity) + 1> StaticBigInt<Capacity>::operator+(const StaticBigInt<OtherCapacity>& summand) const {
+	return GetSignedSum(summand, summand.isNegative);
+}
+template <std::size_t Capacity>
+template <std::size_t OtherCapacity>
+constexpr StaticBigInt<(Capacity > OtherCapacity ? Capacity : OtherCapacity) + 1> StaticBigInt<Capacity>::operator-(const StaticBigInt<OtherCapacity>& subtrahend) const {
+	return GetSignedSum(subtrahend, !subtrahend.isNegative);
+}
+template <std::size_t Capacity>
+template <std::size_t OtherCapacity>
+constexpr StaticBigInt<Capacity + OtherCapacity> StaticBigInt<Capacity>::operator*(const StaticBigInt<OtherCapacity>& multiplier) const {
+	StaticBigInt<Capacity + OtherCapacity> result;
+	result.digitsCount = digitsCount + multiplier.digitsCount;
+	for (std::size_t i = 0; i < digitsCount; ++i) {
+		int carry = 0;
+		for (std::size_t j = 0; j < multiplier.digitsCount; ++j) {
+			int value = result.digits[i + j] + digits[i] * multiplier.digits[j] + carry;
+			result.digits[i + j] = value % 10;
+			carry = value / 10;
+		}
+		result.digits[i + multiplier.digitsCount] += carry;
+	}
+	result.isNegative = (isNegative != multiplier.isNegative);
+	result.Normalize();
+	return result;
+}
+template <std::size_t Capacity>
+template <std::size_t OtherCapacity>
+constexpr bool StaticBigInt<Capacity>::operator==(const StaticBigInt<OtherCapacity>& num) const {
+	return (isNegative == num.isNegative) && (GetAbsoluteCompareResult(num) == 0);
+}
+template <std::size_t Capacity>
+template <std::size_t OtherCapacity>
+constexpr bool StaticBigInt<Capacity>::operator!=(const StaticBigInt<OtherCapacity>& num) const {
+	return !(*this == num);
+}
+template <std::size_t Capacity>
+template <std::size_t OtherCapacity>
+constexpr bool StaticBigInt<Capacity>::operator<(const StaticBigInt<OtherCapacity>& num) const {
+	if (isNegative != num.isNegative)
+		return isNegative;
+	return (isNegative ? GetAbsoluteCompareResult(num) > 0 : GetAbsoluteCompareResult(num) < 0);
+}
+template <std::size_t Capacity>
+StaticBigInt<Capacity>::operator BigInt() const {
+	return BigInt(std::vector<int>(digits, digits + digitsCount), isNegative);
+}
+
+template <std::size_t Capacity>
+template <std::size_t OtherCapacity>
+constexpr int StaticBigInt<Capacity>::GetAbsoluteCompareResult(const StaticBigInt<OtherCapacity>& num) const {
+	if (digitsCount != num.digitsCount)
+		return (digitsCount > num.digitsCount ? 1 : -1);
+	for (std::size_t i = digitsCount; i-- > 0;)
+		if (digits[i] != num.digits[i])
+			return (digits[i] > num.digits[i] ? 1 : -1);
+	return 0;
+}
+template <std::size_t Capacity>
+template <std::size_t OtherCapacity>
+constexpr StaticBigInt<(Capacity > OtherCapacity ? Capacity : OtherCapacity) + 1> StaticBigInt<Capacity>::GetSignedSum(const StaticBigInt<OtherCapacity>& num, const bool& isNumNegative) const {
+	StaticBigInt<(Capacity > OtherCapacity ? Capacity : OtherCapacity) + 1> result;
+	std::size_t longerCount = (digitsCount > num.digitsCount ? digitsCount : num.digitsCount);
+	result.digitsCount = longerCount + 1;
+	if (isNegative == isNumNegative) {
+		// одинаковые знаки: модули складываются
+		int carry = 0;
+		for (std::size_t i = 0; i < longerCount; ++i) {
+			int value = GetDigit(i) + num.GetDigit(i) + carry;
+			result.digits[i] = value % 10;
+			carry = value / 10;
+		}
+		result.digits[longerCount] = carry;
+		result.isNegative = isNegative;
+	}
+	else {
+		// разные знаки: из большего модуля вычитается меньший, знак - у большего
+		bool isThisLarger = (GetAbsoluteCompareResult(num) >= 0);
+		int borrow = 0;
+		for (std::size_t i = 0; i < longerCount; ++i) {
+			int value = (isThisLarger ? GetDigit(i) - num.GetDigit(i) : num.GetDigit(i) - GetDigit(i)) - borrow;
+			borrow = (value < 0 ? 1 : 0);
+			result.digits[i] = value + borrow * 10;
+		}
+		result.isNegative = (isThisLarger ? isNegative : isNumNegative);
+	}
+	result.Normalize();
+	return result;
+}
+template <std::size_t Capacity>
+constexpr void StaticBigInt<Capacity>::Normalize() {
+	while ((digitsCount > 1) && (digits[digitsCount - 1] == 0))
+		--digitsCount;
+	if (digitsCount == 0)
+		digitsCount = 1;
+	if ((digitsCount == 1) && (digits[0] == 0))
+		isNegative = false;
+}
+
+template <char... Chars>
+constexpr StaticBigInt<sizeof...(Chars)> operator""_big() {
+	const char chars[sizeof...(Chars)] = { Chars... };
+	return StaticBigInt<sizeof...(Chars)>(chars, chars + sizeof...(Chars));
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <Instrumentation.h>
+#include <OperationContext.h>
+#include <WorkloadRecording.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// пул потоков с перехватом работы: у каждого рабочего потока своя очередь задач,
+// задачи, добавленные из рабочего потока, попадают в его очередь, из остальных потоков - в общую
+// поток берет новейшие задачи из своей очереди, а без работы забирает старейшие задачи из чужих очередей
+// поток, ожидающий результат задачи через Wait, сам выполняет задачи,
+// поэтому задачи могут порождать подзадачи и ждать их без взаимной блокировки;
+// ожидающий под контекстом операции выполняет только задачи этой же операции, чтобы чужая работа не шла в ее время и срок
+// задача выполняется под контекстом операции (OperationContext) добавившего ее потока, а не того, который ее выполняет:
+// иначе отмена и срок ожидающего потока срабатывали бы в перехваченной им чужой работе;
+// прогресс задачи не сообщает, его сообщает поток, владеющий операцией; счетчики Instrumentation задачи достаются добавившему ее потоку,
+// а глубина вложенности WorkloadRecorder переходит к задаче, чтобы части записанной операции не записывались еще раз
+class BIGINT_API ThreadPool {
+public:
+	// workersCount - количество рабочих потоков (0 - задачи выполняются только ожидающими потоками)
+	ThreadPool(const unsigned& workersCount);
+	~ThreadPool();
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	// общий пул: рабочих потоков на один меньше, чем ядер, так как ожидающий поток тоже выполняет задачи
+	static ThreadPool& GetShared();
+	// количество рабочих потоков общего пула, задается до первого обращения к GetShared
+	static void SetSharedWorkersCount(const unsigned& workersCount);
+	// количество потоков, которые могут одновременно выполнять задачи (рабочие + ожидающий)
+	unsigned GetThreadsCount() const;
+	// добавление задачи в очередь
+	template <typename Function>
+	std::future<decltype(std::declval<Function>()())> Submit(Function function);
+	// ожидание результата задачи с выполнением других задач
+	template <typename T>
+	T Wait(std::future<T>& future);
+private:
+	// состояние добавившего задачу потока, которое переходит к задаче
+	struct TaskState {
+		OperationContext* context;
+		InstrumentationTaskState instrumentation;
+		unsigned recordingDepth;
+	};
+	// на время выполнения задачи привязывает к потоку состояние добавившего ее потока, затем возвращает прежнее
+	class BIGINT_API TaskScope {
+	public:
+		TaskScope(const TaskState& state);
+		TaskScope(const TaskScope&) = delete;
+		TaskScope& operator=(const TaskScope&) = delete;
+	private:
+		OperationScope operationScope;
+		InstrumentationTaskScope instrumentationScope;
+		WorkloadRecordingTaskScope recordingScope;
+	};
+	// задача в очереди и контекст операции добавившего ее потока
+	struct QueuedTask {
+		std::function<void()> run;
+		OperationContext* context;
+	};
+	// очередь задач одного потока
+	struct TasksQueue {
+		std::mutex mutex;
+		std::deque<QueuedTask> tasks;
+	};
+	std::vector<std::thread> workers;
+	// очереди рабочих потоков и последней - общая очередь для остальных потоков
+	std::vector<std::unique_ptr<TasksQueue>> queues;
+	// количество задач во всех очередях, по нему спящие рабочие потоки узнают о новой работе
+	std::atomic<long long> pendingTasksCount;
+	std::mutex sleepMutex;
+	std::condition_variable sleepCondition;
+	bool isStopping;
+	// заданное количество рабочих потоков общего пула (-1 - по количеству ядер)
+	static std::atomic<int> sharedWorkersCount;
+	// пул и очередь текущего потока, если он рабочий
+	static thread_local ThreadPool* currentPool;
+	static thread_local std::size_t currentQueueIndex;
+	static TaskState GetCurrentTaskState();
+	// очередь, в которую текущий поток кладет свои задачи
+	std::size_t GetOwnQueueIndex() const;
+	// выполнение одной задачи из своей очереди или перехваченной из чужой, если задачи есть
+	// при context != nullptr выполняются только задачи, добавленные под этим контекстом
+	bool TryRunPendingTask(OperationContext* context);
+	void RunWorker(const std::size_t& queueIndex);
+};
+
+template <typename Function>
+std::future<decltype(std::declval<Function>()())> ThreadPool::Submit(Function function) {
+	typedef decltype(std::declval<Function>()()) Result;
+	std::shared_ptr<std::packaged_task<Result()>> task = std::make_shared<std::packaged_task<Result()>>(std::move(function));
+	std::future<Result> future = task->get_future();
+	TaskState state = GetCurrentTaskState();
+	TasksQueue& queue = *queues[GetOwnQueueIndex()];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		QueuedTask queuedTask = { [task, state]() {
+			TaskScope scope(state);
+			(*task)();
+		}, state.context };
+		queue.tasks.push_back(std::move(queuedTask));
+	}
+	pendingTasksCount++;
+	// захват мьютекса между увеличением счетчика и оповещением не дает рабочему потоку заснуть, пропустив задачу
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+	}
+	sleepCondition.notify_one();
+	return future;
+}
+template <typename T>
+T ThreadPool::Wait(std::future<T>& future) {
+	OperationContext* context = OperationContext::GetCurrent();
+	// без рабочих потоков чужие задачи больше некому выполнить, поэтому при отсутствии своих берутся и они
+	while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		if (!TryRunPendingTask(context) && (!workers.empty() || !TryRunPendingTask(nullptr)))
+			future.wait_for(std::chrono::microseconds(50));
+	return future.get();
+}
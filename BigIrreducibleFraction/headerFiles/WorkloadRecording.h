@@ -0,0 +1,123 @@
+#pragma once
+
+#include <BigIntExport.h>
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class BigInt;
+
+// запись последовательности операций BigInt и BigIrreducibleFraction в компактный двоичный файл трассы
+// для последующего воспроизведения (workloadReplay) на любой сборке библиотеки
+// включается во время работы (WorkloadRecorder::Start), пока выключена, операция проверяет один атомарный флаг
+// записываются только внешние операции: сложение дробей не пишет умножения и НОД, из которых оно состоит,
+// в том числе выполненные задачами пула потоков (ThreadPool переносит глубину вложенности в задачи)
+// в режиме Sizes пишутся только знаки и количества цифр операндов (при воспроизведении цифры случайные),
+// в режиме Operands - сами операнды
+// формат файла: "BIFTRACE", версия (1 байт), режим (1 байт), затем записи:
+// код операции (1 байт) и операнды в записи BigIntSerialization (в режиме Sizes - без цифр)
+enum class RecordedOperation : unsigned char {
+	Sum,
+	Difference,
+	Product,
+	Quotient,
+	Remainder,
+	GreatestCommonDivisor,
+	FractionSum,
+	FractionDifference,
+	FractionProduct,
+	FractionQuotient,
+	FractionCompare,
+	FractionReduction
+};
+
+enum class RecordingMode : unsigned char {
+	Sizes,
+	Operands
+};
+
+// операнд из файла трассы, в режиме Sizes reversedDigits пуст
+struct RecordedOperand {
+	std::size_t digitsCount;
+	bool isNegative;
+	std::vector<int> reversedDigits;
+};
+
+struct RecordedEvent {
+	RecordedOperation operation;
+	// у операций BigInt и сокращения - два числа, у остальных операций дробей - числители и знаменатели двух дробей
+	std::vector<RecordedOperand> operands;
+};
+
+class BIGINT_API WorkloadRecorder {
+public:
+	static const std::size_t operationsCount = (std::size_t)RecordedOperation::FractionReduction + 1;
+	// начинает запись в файл path (файл перезаписывается), запись, уже идущая в другой файл, завершается
+	static void Start(const std::string& path, const RecordingMode& mode);
+	// завершает запись и закрывает файл
+	static void Stop();
+	static bool IsActive();
+	// количество операций, записанных с последнего Start
+	static unsigned long long GetRecordedCount();
+	static std::size_t GetOperandsCount(const RecordedOperation& operation);
+	static const char* GetOperationName(const RecordedOperation& operation);
+	// глубина вложенных записываемых операций текущего потока
+	static unsigned GetDepth();
+	friend class WorkloadRecordingScope;
+	friend class WorkloadRecordingTaskScope;
+private:
+	static std::atomic<bool> isActive;
+	static std::atomic<unsigned long long> recordedCount;
+	static std::mutex outputMutex;
+	static std::unique_ptr<std::ofstream> output;
+	static std::atomic<RecordingMode> mode;
+	// глубина вложенных записываемых операций текущего потока
+	static thread_local unsigned depth;
+	static void Record(const RecordedOperation& operation, const std::initializer_list<std::reference_wrapper<const BigInt>>& operands);
+};
+
+// записывает операцию, если запись включена и операция не вложена в другую записываемую операцию этого потока
+class BIGINT_API WorkloadRecordingScope {
+public:
+	WorkloadRecordingScope(const RecordedOperation& operation, const std::initializer_list<std::reference_wrapper<const BigInt>>& operands);
+	~WorkloadRecordingScope();
+	WorkloadRecordingScope(const WorkloadRecordingScope&) = delete;
+	WorkloadRecordingScope& operator=(const WorkloadRecordingScope&) = delete;
+private:
+	bool isActive;
+};
+
+// на время выполнения задачи пула задает потоку глубину вложенности добавившего ее потока, затем возвращает свою
+class BIGINT_API WorkloadRecordingTaskScope {
+public:
+	WorkloadRecordingTaskScope(const unsigned& depth);
+	~WorkloadRecordingTaskScope();
+	WorkloadRecordingTaskScope(const WorkloadRecordingTaskScope&) = delete;
+	WorkloadRecordingTaskScope& operator=(const WorkloadRecordingTaskScope&) = delete;
+private:
+	unsigned previousDepth;
+};
+
+// чтение файла трассы: файл читается в память целиком, записи разбираются BigIntSerialization
+class BIGINT_API WorkloadTraceReader {
+public:
+	// бросает std::runtime_error, если файл не открывается или не является трассой
+	WorkloadTraceReader(const std::string& path);
+	WorkloadTraceReader(const WorkloadTraceReader&) = delete;
+	WorkloadTraceReader& operator=(const WorkloadTraceReader&) = delete;
+	RecordingMode GetMode() const;
+	// читает следующую запись, false в конце файла; бросает std::runtime_error, если запись оборвана или повреждена
+	bool Next(RecordedEvent& event);
+private:
+	std::string contents;
+	// первый неразобранный байт contents
+	const char* position;
+	RecordingMode mode;
+};
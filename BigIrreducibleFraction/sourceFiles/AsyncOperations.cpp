@@ -0,0 +1,45 @@
+#include <AsyncOperations.h>
+
+std::future<BigInt> AsyncOperations::Multiply(const BigInt& multiplier1, const BigInt& multiplier2, const std::shared_ptr<OperationContext>& context) {
+	return Run([multiplier1, multiplier2]() {
+		// у умножения нет естественных шагов, поэтому прогресс сообщается только в начале и в конце
+		ProgressScope progressScope;
+		OperationContext::ReportProgress(0);
+		BigInt product = multiplier1 * multiplier2;
+		OperationContext::ReportProgress(1);
+		return product;
+	}, context);
+}
+std::future<BigInt> AsyncOperations::Divide(const BigInt& dividend, const BigInt& divisor, const std::shared_ptr<OperationContext>& context) {
+	if (divisor == 0)
+		throw std::domain_error("AsyncOperations: division by zero");
+	return Run([dividend, divisor]() {
+		return dividend / divisor;
+	}, context);
+}
+std::future<BigInt> AsyncOperations::GetGreatestCommonDivisor(const BigInt& num1, const BigInt& num2, const std::shared_ptr<OperationContext>& context) {
+	return Run([num1, num2]() {
+		return BigInt::GetGreatestCommonDivisor(num1, num2);
+	}, context);
+}
+std::future<BigInt> AsyncOperations::GetPower(const BigInt& base, const unsigned long long& exponent, const std::shared_ptr<OperationContext>& context) {
+	return Run([base, exponent]() {
+		return BigInt::GetPower(base, exponent);
+	}, context);
+}
+std::future<BigIrreducibleFraction> AsyncOperations::Reduce(const BigInt& numerator, const BigInt& denominator, const std::shared_ptr<OperationContext>& context) {
+	if (denominator == 0)
+		throw std::domain_error("AsyncOperations: zero denominator");
+	return Run([numerator, denominator]() {
+		// область прогресса охватывает и НОД, и деления на него: вложенные в нее вычисления прогресс не сообщают,
+		// поэтому деления после НОД не сбрасывают его назад; прогресс сообщается в начале и в конце, как у умножения
+		ProgressScope progressScope;
+		OperationContext::ReportProgress(0);
+		BigInt divisor = BigInt::GetGreatestCommonDivisor(numerator, denominator);
+		if (denominator < 0)
+			divisor = -divisor;
+		BigIrreducibleFraction result = BigIrreducibleFraction::CreateFromReduced(numerator / divisor, denominator / divisor);
+		OperationContext::ReportProgress(1);
+		return result;
+	}, context);
+}
@@ -0,0 +1,715 @@
+#include <BigInt.h>
+
+namespace std {
+	std::size_t hash<BigInt>::operator()(const BigInt& num) const noexcept {
+		return num.GetHash();
+	}
+}
+
+std::atomic<unsigned> BigInt::multiplicationThreadsCount(0);
+std::atomic<std::size_t> BigInt::karatsubaThreshold(256);
+std::atomic<std::size_t> BigInt::parallelMultiplicationThreshold(4096);
+
+BigInt::BigInt() {
+	reversedNumberAbsoluteValue.push_back(0);
+	isNegative = false;
+}
+BigInt::BigInt(const std::string& inputNum) {
+	if (inputNum.length() == 0) {
+		reversedNumberAbsoluteValue.push_back(0);
+		isNegative = false;
+	}
+	else {
+		// перевод строки в BigInt
+		isNegative = ((inputNum[0] == '-') ? true : false);
+		for (int i = inputNum.size() - 1; i >= (isNegative ? 1 : 0); --i)
+			reversedNumberAbsoluteValue.push_back(inputNum[i] - '0');
+		// удаление незначащих нулей
+		while ((reversedNumberAbsoluteValue.size() != 1) && (reversedNumberAbsoluteValue[reversedNumberAbsoluteValue.size() - 1] == 0))
+			reversedNumberAbsoluteValue.pop_back();
+		// проверка числа на равенство 0 для того, чтобы если чего убрать его отрицательность
+		if ((reversedNumberAbsoluteValue.size() == 1) && (reversedNumberAbsoluteValue[0] == 0))
+			isNegative = false;
+	}
+}
+BigInt::BigInt(const std::vector<int>& inputReversedNumberAbsoluteValue, const bool& inputIsNegative) {
+	// копирование параметров
+	isNegative = inputIsNegative;
+	reversedNumberAbsoluteValue = inputReversedNumberAbsoluteValue;
+	// удаление незначащих нулей
+	while ((reversedNumberAbsoluteValue.size() != 1) && (reversedNumberAbsoluteValue[reversedNumberAbsoluteValue.size() - 1] == 0))
+		reversedNumberAbsoluteValue.pop_back();
+	// проверка числа на равенство 0 для того, чтобы если чего убрать его отрицательность
+	if ((reversedNumberAbsoluteValue.size() == 1) && (reversedNumberAbsoluteValue[0] == 0))
+		isNegative = false;
+}
+BigInt::BigInt(std::vector<int>&& inputReversedNumberAbsoluteValue, const bool& inputIsNegative) {
+	// перенос параметров без копирования цифр
+	isNegative = inputIsNegative;
+	reversedNumberAbsoluteValue = std::move(inputReversedNumberAbsoluteValue);
+	// удаление незначащих нулей
+	while ((reversedNumberAbsoluteValue.size() != 1) && (reversedNumberAbsoluteValue[reversedNumberAbsoluteValue.size() - 1] == 0))
+		reversedNumberAbsoluteValue.pop_back();
+	// проверка числа на равенство 0 для того, чтобы если чего убрать его отрицательность
+	if ((reversedNumberAbsoluteValue.size() == 1) && (reversedNumberAbsoluteValue[0] == 0))
+		isNegative = false;
+}
+BigInt::BigInt(const long long& inputNum) {
+	std::string inputNumStr = std::to_string(inputNum);
+	if (inputNumStr.length() == 0) {
+		reversedNumberAbsoluteValue.push_back(0);
+		isNegative = false;
+	}
+	else {
+		// перевод строки в BigInt
+		isNegative = ((inputNumStr[0] == '-') ? true : false);
+		for (int i = inputNumStr.size() - 1; i >= (isNegative ? 1 : 0); --i)
+			reversedNumberAbsoluteValue.push_back(inputNumStr[i] - '0');
+		// удаление незначащих нулей
+		while ((reversedNumberAbsoluteValue.size() != 1) && (reversedNumberAbsoluteValue[reversedNumberAbsoluteValue.size() - 1] == 0))
+			reversedNumberAbsoluteValue.pop_back();
+		// проверка числа на равенство 0 для того, чтобы если чего убрать его отрицательность
+		if ((reversedNumberAbsoluteValue.size() == 1) && (reversedNumberAbsoluteValue[0] == 0))
+			isNegative = false;
+	}
+}
+BigInt::BigInt(const char* begin, const char* end) {
+	isNegative = ((begin != end) && (*begin == '-'));
+	if (isNegative)
+		++begin;
+	// перевод символов в BigInt
+	reversedNumberAbsoluteValue.reserve(end - begin);
+	for (const char* i = end; i != begin;)
+		reversedNumberAbsoluteValue.push_back(*--i - '0');
+	if (reversedNumberAbsoluteValue.empty())
+		reversedNumberAbsoluteValue.push_back(0);
+	// удаление незначащих нулей
+	while ((reversedNumberAbsoluteValue.size() != 1) && (reversedNumberAbsoluteValue[reversedNumberAbsoluteValue.size() - 1] == 0))
+		reversedNumberAbsoluteValue.pop_back();
+	// проверка числа на равенство 0 для того, чтобы если чего убрать его отрицательность
+	if ((reversedNumberAbsoluteValue.size() == 1) && (reversedNumberAbsoluteValue[0] == 0))
+		isNegative = false;
+}
+
+BigInt BigInt::GetSum(const BigInt& summand1, const BigInt& summand2) {
+	BIGINT_INSTRUMENT_KERNEL(Sum, summand1.reversedNumberAbsoluteValue.size() + summand2.reversedNumberAbsoluteValue.size());
+	// проверка разных случаев и выв=зов нужных приватных функций
+	if ((!summand1.isNegative) && (!summand2.isNegative) || (summand1.isNegative) && (summand2.isNegative))
+		return BigInt(GetVectorsSum(summand1.reversedNumberAbsoluteValue, summand2.reversedNumberAbsoluteValue), summand1.isNegative);
+	if (summand1.isNegative)
+		if (BigInt::GetVectorsAbsoluteCompareResult(summand1.reversedNumberAbsoluteValue, summand2.reversedNumberAbsoluteValue) == 1)
+			return BigInt(GetVectorsDifference(summand1.reversedNumberAbsoluteValue, summand2.reversedNumberAbsoluteValue), true);
+		else if (BigInt::GetVectorsAbsoluteCompareResult(summand1.reversedNumberAbsoluteValue, summand2.reversedNumberAbsoluteValue) == -1)
+			return BigInt(GetVectorsDifference(summand2.reversedNumberAbsoluteValue, summand1.reversedNumberAbsoluteValue), false);
+		else
+			return BigInt("0");
+	if (BigInt::GetVectorsAbsoluteCompareResult(summand1.reversedNumberAbsoluteValue, summand2.reversedNumberAbsoluteValue) == 1)
+		return BigInt(GetVectorsDifference(summand1.reversedNumberAbsoluteValue, summand2.reversedNumberAbsoluteValue), false);
+	else if (BigInt::GetVectorsAbsoluteCompareResult(summand1.reversedNumberAbsoluteValue, summand2.reversedNumberAbsoluteValue) == -1)
+		return BigInt(GetVectorsDifference(summand2.reversedNumberAbsoluteValue, summand1.reversedNumberAbsoluteValue), true);
+	else
+		return BigInt("0");
+}
+BigInt BigInt::GetDifference(const BigInt& minuend, const BigInt& subtrahend) {
+	BIGINT_INSTRUMENT_KERNEL(Difference, minuend.reversedNumberAbsoluteValue.size() + subtrahend.reversedNumberAbsoluteValue.size());
+	// проверка разных случаев и выв=зов нужных приватных функций
+	if (!subtrahend.isNegative) {
+		if (minuend.isNegative)
+			return BigInt(GetVectorsSum(minuend.reversedNumberAbsoluteValue, subtrahend.reversedNumberAbsoluteValue), true);
+		else {
+			if (GetVectorsAbsoluteCompareResult(minuend.reversedNumberAbsoluteValue, subtrahend.reversedNumberAbsoluteValue) == 1)
+				return BigInt(GetVectorWithoutLeadingZeros(GetVectorsDifference(minuend.reversedNumberAbsoluteValue, subtrahend.reversedNumberAbsoluteValue)), false);
+			if (GetVectorsAbsoluteCompareResult(minuend.reversedNumberAbsoluteValue, subtrahend.reversedNumberAbsoluteValue) == 0)
+				return BigInt("0");
+			return BigInt(GetVectorWithoutLeadingZeros(GetVectorsDifference(subtrahend.reversedNumberAbsoluteValue, minuend.reversedNumberAbsoluteValue)), true);
+		}
+	}
+	else {
+		if (!minuend.isNegative)
+			return BigInt(GetVectorsSum(minuend.reversedNumberAbsoluteValue, subtrahend.reversedNumberAbsoluteValue), false);
+		else {
+			if (GetVectorsAbsoluteCompareResult(minuend.reversedNumberAbsoluteValue, subtrahend.reversedNumberAbsoluteValue) == -1)
+				return BigInt(GetVectorWithoutLeadingZeros(GetVectorsDifference(subtrahend.reversedNumberAbsoluteValue, minuend.reversedNumberAbsoluteValue)), false);
+			if (GetVectorsAbsoluteCompareResult(minuend.reversedNumberAbsoluteValue, subtrahend.reversedNumberAbsoluteValue) == 0)
+				return BigInt("0");
+			return BigInt(GetVectorWithoutLeadingZeros(GetVectorsDifference(minuend.reversedNumberAbsoluteValue, subtrahend.reversedNumberAbsoluteValue)), true);
+		}
+	}
+}
+BigInt BigInt::GetProduct(const BigInt& multiplier1, const BigInt& multiplier2) {
+	BIGINT_INSTRUMENT_KERNEL(Product, multiplier1.reversedNumberAbsoluteValue.size() + multiplier2.reversedNumberAbsoluteValue.size());
+	LatencyScope latencyScope(TracedOperation::Multiplication, multiplier1.reversedNumberAbsoluteValue.size() + multiplier2.reversedNumberAbsoluteValue.size());
+	int parallelDepth = GetMultiplicationParallelDepth();
+	// проверка разных случаев и выв=зов нужных приватных функций
+	if ((!multiplier1.isNegative) && (!multiplier2.isNegative) || (multiplier1.isNegative) && (multiplier2.isNegative))
+		return BigInt(GetVectorsKaratsubaProduct(multiplier1.reversedNumberAbsoluteValue, multiplier2.reversedNumberAbsoluteValue, parallelDepth), false);
+	return BigInt(GetVectorsKaratsubaProduct(multiplier1.reversedNumberAbsoluteValue, multiplier2.reversedNumberAbsoluteValue, parallelDepth), true);
+}
+BigInt BigInt::GetQuotient(const BigInt& dividend, const BigInt& divisor) {
+	BIGINT_INSTRUMENT_KERNEL(Quotient, dividend.reversedNumberAbsoluteValue.size() + divisor.reversedNumberAbsoluteValue.size());
+	LatencyScope latencyScope(TracedOperation::Division, dividend.reversedNumberAbsoluteValue.size() + divisor.reversedNumberAbsoluteValue.size());
+	// проверка разных случаев и выв=зов нужных приватных функций
+	if (dividend.reversedNumberAbsoluteValue.size() < divisor.reversedNumberAbsoluteValue.size())
+		return BigInt("0");
+	if ((!dividend.isNegative) && (!divisor.isNegative) || (dividend.isNegative) && (divisor.isNegative))
+		return BigInt(GetVectorWithoutLeadingZeros(GetVectorQuotient(dividend.reversedNumberAbsoluteValue, divisor.reversedNumberAbsoluteValue)), false);
+	return BigInt(GetVectorWithoutLeadingZeros(GetVectorQuotient(dividend.reversedNumberAbsoluteValue, divisor.reversedNumberAbsoluteValue)), true);
+}
+
+BigInt operator+(const BigInt& summand1, const BigInt& summand2) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::Sum, { summand1, summand2 });
+	return BigInt::GetSum(summand1, summand2);
+}
+BigInt operator-(const BigInt& minuend, const BigInt& subtrahend) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::Difference, { minuend, subtrahend });
+	return BigInt::GetDifference(minuend, subtrahend);
+}
+BigInt operator*(const BigInt& multiplier1, const BigInt& multiplier2) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::Product, { multiplier1, multiplier2 });
+	return BigInt::GetProduct(multiplier1, multiplier2);
+}
+BigInt operator/(const BigInt& dividend, const BigInt& divisor) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::Quotient, { dividend, divisor });
+	return BigInt::GetQuotient(dividend, divisor);
+}
+BigInt operator%(const BigInt& dividend, const BigInt& divisor) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::Remainder, { dividend, divisor });
+	return dividend - ((dividend / divisor) * divisor);
+}
+BigInt& BigInt::operator+=(const BigInt& summand) {
+	return *this = *this + summand;
+}
+BigInt& BigInt::operator-=(const BigInt& subtrahend) {
+	return *this = *this - subtrahend;
+}
+BigInt& BigInt::operator*=(const BigInt& multiplier) {
+	return *this = *this * multiplier;
+}
+BigInt& BigInt::operator/=(const BigInt& divisor) {
+	return *this = *this / divisor;
+}
+BigInt& BigInt::operator%=(const BigInt& divisor) {
+	return *this = *this % divisor;
+}
+BigInt& BigInt::operator++() {
+	return *this = *this + 1;
+}
+BigInt& BigInt::operator--() {
+	return *this = *this - 1;
+}
+BigInt BigInt::operator++(int) {
+	BigInt temp = *this;
+	++* this;
+	return temp;
+}
+BigInt BigInt::operator--(int) {
+	BigInt temp = *this;
+	--* this;
+	return temp;
+}
+BigInt BigInt::operator+() const {
+	return *this;
+}
+BigInt BigInt::operator-() const {
+	// цифры остаются общими с исходным числом, меняется только знак
+	BigInt result = *this;
+	result.hashCache.Reset();
+	if ((reversedNumberAbsoluteValue.size() != 1) || (reversedNumberAbsoluteValue[0] != 0))
+		result.isNegative = !isNegative;
+	return result;
+}
+bool operator==(const BigInt& num1, const BigInt& num2) noexcept {
+	// числа хранятся без незначащих нулей, поэтому равные числа совпадают поцифрово
+	if ((num1.isNegative != num2.isNegative) || (num1.reversedNumberAbsoluteValue.size() != num2.reversedNumberAbsoluteValue.size()))
+		return false;
+	// разные посчитанные хэши сразу означают разные числа
+	std::size_t hash1, hash2;
+	if (num1.hashCache.TryGet(hash1) && num2.hashCache.TryGet(hash2) && (hash1 != hash2))
+		return false;
+	// копии одного числа разделяют цифры
+	if (&num1.reversedNumberAbsoluteValue.Get() == &num2.reversedNumberAbsoluteValue.Get())
+		return true;
+	return num1.reversedNumberAbsoluteValue.Get() == num2.reversedNumberAbsoluteValue.Get();
+}
+bool operator!=(const BigInt& num1, const BigInt& num2) noexcept {
+	return !(num1 == num2);
+}
+bool operator>(const BigInt& num1, const BigInt& num2) noexcept {
+	return BigInt::GetCompareResult(num1, num2) == 1;
+}
+bool operator>=(const BigInt& num1, const BigInt& num2) noexcept {
+	return BigInt::GetCompareResult(num1, num2) >= 0;
+}
+bool operator<(const BigInt& num1, const BigInt& num2) noexcept {
+	return BigInt::GetCompareResult(num1, num2) == -1;
+}
+bool operator<=(const BigInt& num1, const BigInt& num2) noexcept {
+	return BigInt::GetCompareResult(num1, num2) <= 0;
+}
+BigInt& BigInt::operator=(const std::string& inputNum) {
+	// очистка предыдущего числа для перезаписи
+	reversedNumberAbsoluteValue.clear();
+	hashCache.Reset();
+	if (inputNum.length() == 0) {
+		reversedNumberAbsoluteValue.push_back(0);
+		isNegative = false;
+	}
+	else {
+		// перевод строки в BigInt
+		isNegative = ((inputNum[0] == '-') ? true : false);
+		for (int i = inputNum.size() - 1; i >= (isNegative ? 1 : 0); --i)
+			reversedNumberAbsoluteValue.push_back(inputNum[i] - '0');
+		// удаление незначащих нулей
+		while ((reversedNumberAbsoluteValue.size() != 1) && (reversedNumberAbsoluteValue[reversedNumberAbsoluteValue.size() - 1] == 0))
+			reversedNumberAbsoluteValue.pop_back();
+		// проверка числа на равенство 0 для того, чтобы если чего убрать его отрицательность
+		if ((reversedNumberAbsoluteValue.size() == 1) && (reversedNumberAbsoluteValue[0] == 0))
+			isNegative = false;
+	}
+	return *this;
+}
+BigInt& BigInt::operator=(const long long& inputNum) {
+	std::string inputNumStr = std::to_string(inputNum);
+	// очистка предыдущего числа для перезаписи
+	reversedNumberAbsoluteValue.clear();
+	hashCache.Reset();
+	if (inputNumStr.length() == 0) {
+		reversedNumberAbsoluteValue.push_back(0);
+		isNegative = false;
+	}
+	else {
+		// перевод строки в BigInt
+		isNegative = ((inputNumStr[0] == '-') ? true : false);
+		for (int i = inputNumStr.size() - 1; i >= (isNegative ? 1 : 0); --i)
+			reversedNumberAbsoluteValue.push_back(inputNumStr[i] - '0');
+		// удаление незначащих нулей
+		while ((reversedNumberAbsoluteValue.size() != 1) && (reversedNumberAbsoluteValue[reversedNumberAbsoluteValue.size() - 1] == 0))
+			reversedNumberAbsoluteValue.pop_back();
+		// проверка числа на равенство 0 для того, чтобы если чего убрать его отрицательность
+		if ((reversedNumberAbsoluteValue.size() == 1) && (reversedNumberAbsoluteValue[0] == 0))
+			isNegative = false;
+	}
+	return *this;
+}
+BigInt BigInt::GetGreatestCommonDivisor(const BigInt& num1, const BigInt& num2) {
+	BIGINT_INSTRUMENT_KERNEL(GreatestCommonDivisor, num1.reversedNumberAbsoluteValue.size() + num2.reversedNumberAbsoluteValue.size());
+	LatencyScope latencyScope(TracedOperation::GreatestCommonDivisor, num1.reversedNumberAbsoluteValue.size() + num2.reversedNumberAbsoluteValue.size());
+	WorkloadRecordingScope recordingScope(RecordedOperation::GreatestCommonDivisor, { num1, num2 });
+	BigInt remainder1(num1.reversedNumberAbsoluteValue, false);
+	BigInt remainder2(num2.reversedNumberAbsoluteValue, false);
+	// прогресс оценивается по тому, насколько укоротился второй остаток
+	ProgressScope progressScope;
+	double initialDigitsCount = remainder2.reversedNumberAbsoluteValue.size();
+	while (remainder2 != 0) {
+		OperationContext::Checkpoint();
+		BIGINT_INSTRUMENT_ITERATION(GreatestCommonDivisor);
+		BigInt remainder = remainder1 % remainder2;
+		remainder1 = remainder2;
+		remainder2 = remainder;
+		OperationContext::ReportProgress(1 - remainder2.reversedNumberAbsoluteValue.size() / initialDigitsCount);
+	}
+	OperationContext::ReportProgress(1);
+	return remainder1;
+}
+BigInt BigInt::GetPower(const BigInt& base, const unsigned long long& exponent) {
+	BIGINT_INSTRUMENT_KERNEL(Power, base.reversedNumberAbsoluteValue.size());
+	// двоичная запись показателя проходится от старших битов к младшим
+	ProgressScope progressScope;
+	int bitsCount = 0;
+	while ((bitsCount < 64) && ((exponent >> bitsCount) != 0))
+		++bitsCount;
+	BigInt result = 1;
+	for (int bit = bitsCount - 1; bit >= 0; --bit) {
+		OperationContext::Checkpoint();
+		BIGINT_INSTRUMENT_ITERATION(Power);
+		result = result * result;
+		if ((exponent >> bit) & 1)
+			result = result * base;
+		OperationContext::ReportProgress((double)(bitsCount - bit) / bitsCount);
+	}
+	OperationContext::ReportProgress(1);
+	return result;
+}
+BigInt BigInt::GetRoot(const BigInt& num, const unsigned& degree) {
+	if (degree == 0)
+		throw std::invalid_argument("BigInt: root degree must be positive");
+	if (num.isNegative && (degree % 2 == 0))
+		throw std::domain_error("BigInt: even root of negative number");
+	BIGINT_INSTRUMENT_KERNEL(Root, num.reversedNumberAbsoluteValue.size());
+	BigInt root = GetNonNegativeRoot(BigInt(num.reversedNumberAbsoluteValue, false), degree);
+	return (num.isNegative ? -root : root);
+}
+BigInt BigInt::GetSquareRoot(const BigInt& num) {
+	return GetRoot(num, 2);
+}
+bool BigInt::IsPerfectSquare(const BigInt& num) {
+	if (num.isNegative || !IsPossibleSquare(num))
+		return false;
+	BigInt root = GetNonNegativeRoot(num, 2);
+	return root * root == num;
+}
+std::size_t BigInt::GetHash() const noexcept {
+	std::size_t hash;
+	if (hashCache.TryGet(hash))
+		return hash;
+	// цифры собираются в блоки по 19 штук, каждый блок перемешивается с хэшем умножением
+	unsigned long long mixedHash = 0x9E3779B97F4A7C15ULL ^ (reversedNumberAbsoluteValue.size() * 2 + (isNegative ? 1 : 0));
+	for (std::size_t blockBegin = 0; blockBegin < reversedNumberAbsoluteValue.size(); blockBegin += 19) {
+		std::size_t blockEnd = (blockBegin + 19 < reversedNumberAbsoluteValue.size() ? blockBegin + 19 : reversedNumberAbsoluteValue.size());
+		unsigned long long block = 0;
+		for (std::size_t i = blockBegin; i < blockEnd; ++i)
+			block = block * 10 + reversedNumberAbsoluteValue[i];
+		mixedHash = (mixedHash ^ block) * 0xFF51AFD7ED558CCDULL;
+		mixedHash ^= mixedHash >> 29;
+	}
+	mixedHash ^= mixedHash >> 32;
+	hash = (std::size_t)mixedHash;
+	// 0 в кэше означает отсутствие хэша
+	if (hash == 0)
+		hash = 1;
+	hashCache.Set(hash);
+	return hash;
+}
+void BigInt::SetMultiplicationThreadsCount(const unsigned& threadsCount) {
+	multiplicationThreadsCount = threadsCount;
+}
+void BigInt::SetKaratsubaThreshold(const std::size_t& digitsCount) {
+	karatsubaThreshold = digitsCount;
+}
+void BigInt::SetParallelMultiplicationThreshold(const std::size_t& digitsCount) {
+	parallelMultiplicationThreshold = digitsCount;
+}
+unsigned BigInt::GetMultiplicationThreadsCount() {
+	return multiplicationThreadsCount;
+}
+std::size_t BigInt::GetKaratsubaThreshold() {
+	return karatsubaThreshold;
+}
+std::size_t BigInt::GetParallelMultiplicationThreshold() {
+	return parallelMultiplicationThreshold;
+}
+std::ostream& operator<<(std::ostream& os, const BigInt& num) {
+	if (num.isNegative)
+		os << "-";
+	for (int i = num.reversedNumberAbsoluteValue.size() - 1; i >= 0; --i)
+		os << num.reversedNumberAbsoluteValue[i];
+	return os;
+}
+
+int BigInt::GetAbsoluteCompareResult(const BigInt& bigInt1, const BigInt& bigInt2) noexcept {
+	return GetVectorsAbsoluteCompareResult(bigInt1.reversedNumberAbsoluteValue, bigInt2.reversedNumberAbsoluteValue);
+}
+int BigInt::GetCompareResult(const BigInt& bigInt1, const BigInt& bigInt2) noexcept {
+	// проверка разных случаев и выв=зов нужных приватных функций
+	if ((!bigInt1.isNegative) && (!bigInt2.isNegative))
+		return GetVectorsAbsoluteCompareResult(bigInt1.reversedNumberAbsoluteValue, bigInt2.reversedNumberAbsoluteValue);
+	if ((bigInt1.isNegative) && (bigInt2.isNegative))
+		return GetVectorsAbsoluteCompareResult(bigInt1.reversedNumberAbsoluteValue, bigInt2.reversedNumberAbsoluteValue) * (-1);
+	if ((!bigInt1.isNegative) && (bigInt2.isNegative))
+		return 1;
+	else
+		return -1;
+}
+
+int BigInt::GetVectorsAbsoluteCompareResult(const std::vector<int>& num1, const std::vector<int>& num2) noexcept {
+	// незначащие нули не учитываются в размерах, векторы при этом не копируются
+	std::size_t num1Size = num1.size(), num2Size = num2.size();
+	while ((num1Size > 1) && (num1[num1Size - 1] == 0))
+		--num1Size;
+	while ((num2Size > 1) && (num2[num2Size - 1] == 0))
+		--num2Size;
+	// сравниваем размеры чисел, а после, если размеры чисел равны, сравниваем цифры чисел с одинаковым разрядом
+	if (num1Size > num2Size)
+		return 1;
+	else if (num1Size < num2Size)
+		return -1;
+	else {
+		for (std::size_t i = num1Size; i-- > 0;)
+			if (num1[i] > num2[i])
+				return 1;
+			else if (num1[i] < num2[i])
+				return -1;
+		return 0;
+	}
+}
+std::vector<int> BigInt::GetVectorsSum(std::vector<int> summand1, std::vector<int> summand2) {
+	// убираем незначащие нули для корректности выполнения
+	summand1 = GetVectorWithoutLeadingZeros(summand1);
+	summand2 = GetVectorWithoutLeadingZeros(summand2);
+	// vectorsSum - результат, isWasOverNine - хранение переполнения
+	std::vector<int> vectorsSum;
+	bool isWasOverNine = false;
+	int i = 0;
+	// пока i меньше размера числа, размер которого меньше, скоадываем цифры
+	for (; i < (int)((summand1.size() < summand2.size()) ? summand1.size() : summand2.size()); ++i) {
+		int iDigitsSum = summand1[i] + summand2[i] + (isWasOverNine ? 1 : 0);
+		isWasOverNine = (iDigitsSum >= 10);
+		vectorsSum.push_back(iDigitsSum % 10);
+	}
+	// если размеры чисел были равные, то при наличии переполнения isWasOverNine, добавляем еще 1 разряд
+	if (summand1.size() == summand2.size()) {
+		if (isWasOverNine)
+			vectorsSum.push_back(1);
+	}
+	// если одно из чисел больше, то копируем оставшиеся разряды в результат сложения, продолжая перенос
+	else {
+		const std::vector<int>& longerSummand = ((summand1.size() > summand2.size()) ? summand1 : summand2);
+		for (; i < (int)longerSummand.size(); ++i) {
+			int iDigitsSum = longerSummand[i] + (isWasOverNine ? 1 : 0);
+			isWasOverNine = (iDigitsSum >= 10);
+			vectorsSum.push_back(iDigitsSum % 10);
+		}
+		if (isWasOverNine)
+			vectorsSum.push_back(1);
+	}
+	return GetVectorWithoutLeadingZeros(vectorsSum);
+}
+std::vector<int> BigInt::GetVectorsDifference(std::vector<int> minuend, std::vector<int> subtrahend) {
+	// убираем незначащие нули для корректности выполнения
+	minuend = GetVectorWithoutLeadingZeros(minuend);
+	subtrahend = GetVectorWithoutLeadingZeros(subtrahend);
+	// vectorsDifference - результат вычитания
+	std::vector<int> vectorsDifference;
+	// вычитаем поразрядно, при и забираем единицу у более старшего разряда при необходимости
+	int i = 0;
+	for (; i < (int)subtrahend.size(); ++i) {
+		int iDigitsDifference = minuend[i] - subtrahend[i];
+		if (iDigitsDifference < 0) {
+			iDigitsDifference += 10;
+			minuend[i + 1]--;
+		}
+		vectorsDifference.push_back(iDigitsDifference);
+	}
+	// копируем оставшиеся разряды, продолжая заем из старших разрядов
+	for (; i < (int)minuend.size(); ++i) {
+		if (minuend[i] < 0) {
+			minuend[i] += 10;
+			minuend[i + 1]--;
+		}
+		vectorsDifference.push_back(minuend[i]);
+	}
+	return GetVectorWithoutLeadingZeros(vectorsDifference);
+}
+std::vector<int> BigInt::GetVectorsProduct(std::vector<int> multiplier1, std::vector<int> multiplier2) {
+	// убираем незначащие нули для корректности выполнения
+	multiplier1 = GetVectorWithoutLeadingZeros(multiplier1);
+	multiplier2 = GetVectorWithoutLeadingZeros(multiplier2);
+	// vectorsProduct - результат произведения, размер произведения - сумма размеров множителей + 1
+	std::vector<int> vectorsProduct(multiplier1.size() + multiplier2.size() + 1);
+	// в ячейку результата i + j складываем произведение разрядов
+	for (int i = 0; i < (int)multiplier1.size(); ++i) {
+		OperationContext::Checkpoint();
+		for (int j = 0; j < (int)multiplier2.size(); ++j)
+			vectorsProduct[i + j] += multiplier1[i] * multiplier2[j];
+	}
+	// идем от начала результат к концу и перекидываем переполненные части текущих разрядов в более старшие разряды
+	for (int i = 0; i < (int)vectorsProduct.size(); ++i) {
+		if (vectorsProduct[i] > 9)
+			vectorsProduct[i + 1] += vectorsProduct[i] / 10;
+		vectorsProduct[i] %= 10;
+	}
+	return GetVectorWithoutLeadingZeros(vectorsProduct);
+}
+std::vector<int> BigInt::GetVectorQuotient(std::vector<int> dividend, std::vector<int> divisor) {
+	// убираем незначащие нули для корректности выполнения
+	dividend = GetVectorWithoutLeadingZeros(dividend);
+	divisor = GetVectorWithoutLeadingZeros(divisor);
+	// carry - текущий остаток, изначально равный 0, base - текущая система счисления, равная 10, созданый для удобства проведения операций над ними
+	std::vector<int> carry;
+	carry.push_back(0);
+	std::vector<int> base;
+	base.push_back(0);
+	base.push_back(1);
+	// dividendI - хранение текущего разряда делимого
+	std::vector<int> dividendI;
+	ProgressScope progressScope;
+	for (int i = dividend.size() - 1; i >= 0; --i) {
+		OperationContext::Checkpoint();
+		BIGINT_INSTRUMENT_ITERATION(Quotient);
+		OperationContext::ReportProgress((double)(dividend.size() - 1 - i) / dividend.size());
+		// очищаем dividendI и кладем туда текущий разряд
+		dividendI.clear();
+		dividendI.push_back(dividend[i]);
+		// задаем текущее делимое число как как сумму текущего разряда и остатка, помноженного на 10
+		std::vector<int> current = GetVectorsSum(dividendI, GetVectorsProduct(carry, base));
+		// divResult - результат целочисленного деления, ищется постепенным его увеличением на 1 и сравнением
+		std::vector<int> divResult;
+		divResult.push_back(0);
+		while (GetVectorsAbsoluteCompareResult(GetVectorsProduct(divResult, divisor), current) <= 0)
+			divResult[0]++;
+		divResult[0]--;
+		// кладем в текущий разряд делимого результат целочисленного деления
+		dividend[i] = divResult[0];
+		// обновлвем остаток разницей текущего делимого и произведения делителя на результат целочисленного деления
+		carry.clear();
+		carry = GetVectorsDifference(current, GetVectorsProduct(divisor, divResult));
+	}
+	return GetVectorWithoutLeadingZeros(dividend);
+}
+std::vector<int> BigInt::GetVectorsKaratsubaProduct(const std::vector<int>& multiplier1, const std::vector<int>& multiplier2, const int& parallelDepth) {
+	const std::vector<int>& longer = ((multiplier1.size() >= multiplier2.size()) ? multiplier1 : multiplier2);
+	const std::vector<int>& shorter = ((multiplier1.size() >= multiplier2.size()) ? multiplier2 : multiplier1);
+	// при меньших размерах сумма половин не короче самого числа, и рекурсия не уменьшала бы задачу
+	std::size_t minimalKaratsubaSize = 4;
+	if ((shorter.size() < karatsubaThreshold.load()) || (shorter.size() < minimalKaratsubaSize))
+		return GetVectorsProduct(longer, shorter);
+	// longer = longerHigh * 10^half + longerLow, shorter делится так же
+	std::size_t half = longer.size() / 2;
+	std::vector<int> longerLow = GetVectorPart(longer, 0, half);
+	std::vector<int> longerHigh = GetVectorPart(longer, half, longer.size());
+	std::vector<int> shorterLow = GetVectorPart(shorter, 0, half);
+	std::vector<int> shorterHigh = GetVectorPart(shorter, half, shorter.size());
+	bool isShorterHighZero = (shorter.size() <= half);
+	OperationContext::Checkpoint();
+	// произведения младших и старших половин независимы и при большом размере отдаются в пул потоков
+	ThreadPool& pool = ThreadPool::GetShared();
+	bool isParallel = ((parallelDepth > 0) && (shorter.size() >= parallelMultiplicationThreshold.load()));
+	std::future<std::vector<int>> lowProductFuture, highProductFuture;
+	std::vector<int> lowProduct, highProduct, middleProduct;
+	try {
+		if (isParallel) {
+			// пул выполняет подзадачи под контекстом операции текущего потока, поэтому отмена доходит и до них
+			lowProductFuture = pool.Submit([&]() { return GetVectorsKaratsubaProduct(longerLow, shorterLow, parallelDepth - 1); });
+			if (!isShorterHighZero)
+				highProductFuture = pool.Submit([&]() { return GetVectorsKaratsubaProduct(longerHigh, shorterHigh, parallelDepth - 1); });
+		}
+		else {
+			lowProduct = GetVectorsKaratsubaProduct(longerLow, shorterLow, 0);
+			if (!isShorterHighZero)
+				highProduct = GetVectorsKaratsubaProduct(longerHigh, shorterHigh, 0);
+		}
+		// если у короткого множителя нет старшей половины, вместо произведения сумм нужно только longerHigh * shorter
+		if (isShorterHighZero)
+			middleProduct = GetVectorsKaratsubaProduct(longerHigh, shorterLow, parallelDepth - (isParallel ? 1 : 0));
+		else
+			middleProduct = GetVectorsKaratsubaProduct(GetVectorsSum(longerLow, longerHigh), GetVectorsSum(shorterLow, shorterHigh), parallelDepth - (isParallel ? 1 : 0));
+		if (isParallel) {
+			lowProduct = pool.Wait(lowProductFuture);
+			if (!isShorterHighZero)
+				highProduct = pool.Wait(highProductFuture);
+		}
+	}
+	catch (...) {
+		// подзадачи ссылаются на локальные половины, поэтому перед выходом их нужно дождаться
+		std::future<std::vector<int>>* futures[] = { &lowProductFuture, &highProductFuture };
+		for (std::size_t i = 0; i < 2; ++i)
+			if (futures[i]->valid())
+				try {
+					pool.Wait(*futures[i]);
+				}
+				catch (...) {
+				}
+		throw;
+	}
+	std::vector<int> product(longer.size() + shorter.size() + 1, 0);
+	AddShiftedVector(product, lowProduct, 0);
+	if (isShorterHighZero)
+		AddShiftedVector(product, middleProduct, half);
+	else {
+		// (low + high) * (low + high) - low * low - high * high = перекрестные произведения
+		AddShiftedVector(product, GetVectorsDifference(GetVectorsDifference(middleProduct, lowProduct), highProduct), half);
+		AddShiftedVector(product, highProduct, 2 * half);
+	}
+	return GetVectorWithoutLeadingZeros(product);
+}
+int BigInt::GetMultiplicationParallelDepth() {
+	unsigned threadsCount = multiplicationThreadsCount.load();
+	if (threadsCount == 0)
+		threadsCount = ThreadPool::GetShared().GetThreadsCount();
+	int parallelDepth = 0;
+	for (unsigned tasksCount = 1; tasksCount < threadsCount; tasksCount *= 3)
+		++parallelDepth;
+	return parallelDepth;
+}
+std::vector<int> BigInt::GetVectorPart(const std::vector<int>& num, const std::size_t& from, const std::size_t& to) {
+	if (from >= num.size())
+		return std::vector<int>(1, 0);
+	std::vector<int> part(num.begin() + from, num.begin() + (to < num.size() ? to : num.size()));
+	if (part.empty())
+		part.push_back(0);
+	return GetVectorWithoutLeadingZeros(part);
+}
+void BigInt::AddShiftedVector(std::vector<int>& result, const std::vector<int>& term, const std::size_t& shift) {
+	int carry = 0;
+	std::size_t i = 0;
+	for (; i < term.size(); ++i) {
+		int digitsSum = result[shift + i] + term[i] + carry;
+		carry = (digitsSum >= 10 ? 1 : 0);
+		result[shift + i] = digitsSum - carry * 10;
+	}
+	for (; carry != 0; ++i) {
+		int digitsSum = result[shift + i] + carry;
+		carry = (digitsSum >= 10 ? 1 : 0);
+		result[shift + i] = digitsSum - carry * 10;
+	}
+}
+bool BigInt::IsPossibleSquare(const BigInt& num) {
+	// квадраты по модулю 100 определяются двумя последними цифрами, по модулю 9 и 11 - суммой и знакочередующейся суммой цифр
+	static const bool isSquareModulo100[100] = {
+		1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0
+	};
+	static const bool isSquareModulo9[9] = { 1, 1, 0, 0, 1, 0, 0, 1, 0 };
+	static const bool isSquareModulo11[11] = { 1, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0 };
+	const std::vector<int>& digits = num.reversedNumberAbsoluteValue;
+	int lastDigits = digits[0] + (digits.size() > 1 ? digits[1] * 10 : 0);
+	if (!isSquareModulo100[lastDigits])
+		return false;
+	unsigned long long digitsSum = 0, alternatingSum = 0;
+	for (std::size_t i = 0; i < digits.size(); ++i) {
+		digitsSum += digits[i];
+		// 10 = -1 по модулю 11, к нечетным разрядам прибавляется 10 * цифра, что равно -цифре
+		alternatingSum += (i % 2 == 0 ? digits[i] : 10 * digits[i]);
+	}
+	return isSquareModulo9[digitsSum % 9] && isSquareModulo11[alternatingSum % 11];
+}
+BigInt BigInt::GetNonNegativeRoot(const BigInt& num, const unsigned& degree) {
+	if ((degree == 1) || (num < 2))
+		return num;
+	OperationContext::Checkpoint();
+	const std::vector<int>& digits = num.reversedNumberAbsoluteValue;
+	std::size_t digitsCount = digits.size();
+	// числа до 10^18 - через long double с точной поправкой
+	if ((degree == 2) && (digitsCount <= 18)) {
+		unsigned long long value = 0;
+		for (std::size_t i = digitsCount; i-- > 0;)
+			value = value * 10 + digits[i];
+		unsigned long long root = (unsigned long long)std::sqrt((long double)value);
+		while (root * root > value)
+			--root;
+		while ((root + 1) * (root + 1) <= value)
+			++root;
+		return BigInt((long long)root);
+	}
+	// начальное приближение не меньше корня: (корень из старших цифр + 1) * 10^shift,
+	// где старшие цифры - num / 10^(degree * shift), а их корень верен примерно в половине цифр результата
+	std::size_t shift = digitsCount / (2 * degree);
+	BigInt root;
+	if (shift == 0) {
+		std::vector<int> powerOfTen((digitsCount + degree - 1) / degree + 1, 0);
+		powerOfTen.back() = 1;
+		root = BigInt(std::move(powerOfTen), false);
+	}
+	else {
+		std::vector<int> rootDigits(shift, 0);
+		BigInt highRoot = GetNonNegativeRoot(BigInt(GetVectorPart(digits, degree * shift, digitsCount), false), degree) + 1;
+		const std::vector<int>& highRootDigits = highRoot.reversedNumberAbsoluteValue;
+		rootDigits.insert(rootDigits.end(), highRootDigits.begin(), highRootDigits.end());
+		root = BigInt(std::move(rootDigits), false);
+	}
+	// итерации Ньютона x = ((degree - 1) * x + num / x^(degree - 1)) / degree убывают, пока не дойдут до целой части корня
+	while (true) {
+		OperationContext::Checkpoint();
+		BIGINT_INSTRUMENT_ITERATION(Root);
+		BigInt nextRoot = (BigInt((long long)degree - 1) * root + num / GetPower(root, degree - 1)) / (long long)degree;
+		if (nextRoot >= root)
+			return root;
+		root = nextRoot;
+	}
+}
+std::vector<int> BigInt::GetVectorWithoutLeadingZeros(std::vector<int> num) {
+	while ((num.size() != 1) && (num[num.size() - 1] == 0))
+		num.pop_back();
+	return num;
+}
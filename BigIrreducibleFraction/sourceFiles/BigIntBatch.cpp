@@ -0,0 +1,144 @@
+#include <BigIntBatch.h>
+
+BigIntBatch::BigIntBatch() {
+}
+BigIntBatch::BigIntBatch(const std::vector<BigInt>& nums) {
+	Reserve(nums.size());
+	for (std::size_t i = 0; i < nums.size(); ++i)
+		PushBack(nums[i]);
+}
+std::size_t BigIntBatch::GetSize() const {
+	return lanes.size();
+}
+void BigIntBatch::Reserve(const std::size_t& size) {
+	lanes.reserve(size);
+	isOverflowed.reserve(size);
+}
+void BigIntBatch::PushBack(const BigInt& num) {
+	long long value;
+	if (TryGetLaneValue(num, value)) {
+		lanes.push_back(value);
+		isOverflowed.push_back(0);
+	}
+	else {
+		overflowIndexes.push_back(lanes.size());
+		overflowValues.push_back(num);
+		lanes.push_back(0);
+		isOverflowed.push_back(1);
+	}
+}
+void BigIntBatch::PushBack(const long long& num) {
+	if ((num >= -laneLimit) && (num <= laneLimit)) {
+		lanes.push_back(num);
+		isOverflowed.push_back(0);
+	}
+	else
+		PushBack(BigInt(num));
+}
+BigInt BigIntBatch::Get(const std::size_t& index) const {
+	if (!isOverflowed[index])
+		return BigInt(lanes[index]);
+	std::size_t position = std::lower_bound(overflowIndexes.begin(), overflowIndexes.end(), index) - overflowIndexes.begin();
+	return overflowValues[position];
+}
+std::vector<BigInt> BigIntBatch::ToVector() const {
+	std::vector<BigInt> result;
+	result.reserve(lanes.size());
+	for (std::size_t i = 0, position = 0; i < lanes.size(); ++i)
+		result.push_back(isOverflowed[i] ? overflowValues[position++] : BigInt(lanes[i]));
+	return result;
+}
+std::size_t BigIntBatch::GetOverflowsCount() const {
+	return overflowValues.size();
+}
+
+BigIntBatch BigIntBatch::GetSum(const BigIntBatch& batch1, const BigIntBatch& batch2) {
+	CheckSizes(batch1, batch2);
+	std::size_t size = batch1.lanes.size();
+	BigIntBatch result;
+	result.lanes.resize(size);
+	result.isOverflowed.assign(size, 0);
+	for (std::size_t i = 0; i < size; ++i)
+		result.lanes[i] = batch1.lanes[i] + batch2.lanes[i];
+	std::vector<unsigned char> needsBigInt;
+	MarkOverflows(batch1, batch2, result.lanes, needsBigInt);
+	for (std::size_t i = 0; i < size; ++i)
+		if (needsBigInt[i])
+			result.SetOverflowResult(i, BigInt::GetSum(batch1.Get(i), batch2.Get(i)));
+	return result;
+}
+BigIntBatch BigIntBatch::GetProduct(const BigIntBatch& batch1, const BigIntBatch& batch2) {
+	CheckSizes(batch1, batch2);
+	std::size_t size = batch1.lanes.size();
+	BigIntBatch result;
+	result.lanes.resize(size);
+	result.isOverflowed.assign(size, 0);
+	for (std::size_t i = 0; i < size; ++i)
+		result.lanes[i] = batch1.lanes[i] * batch2.lanes[i];
+	std::vector<unsigned char> needsBigInt;
+	MarkOverflows(batch1, batch2, result.lanes, needsBigInt);
+	for (std::size_t i = 0; i < size; ++i)
+		if (needsBigInt[i])
+			result.SetOverflowResult(i, BigInt::GetProduct(batch1.Get(i), batch2.Get(i)));
+	return result;
+}
+std::vector<int> BigIntBatch::GetCompareResults(const BigIntBatch& batch1, const BigIntBatch& batch2) {
+	CheckSizes(batch1, batch2);
+	std::size_t size = batch1.lanes.size();
+	std::vector<int> result(size);
+	for (std::size_t i = 0; i < size; ++i)
+		result[i] = (batch1.lanes[i] > batch2.lanes[i]) - (batch1.lanes[i] < batch2.lanes[i]);
+	// сравнения с BigInt пересчитываются отдельно
+	for (std::size_t i = 0; i < size; ++i)
+		if (batch1.isOverflowed[i] | batch2.isOverflowed[i])
+			result[i] = BigInt::GetCompareResult(batch1.Get(i), batch2.Get(i));
+	return result;
+}
+BigInt BigIntBatch::GetTotalSum() const {
+	BigInt result = 0;
+	for (std::size_t blockBegin = 0; blockBegin < lanes.size(); blockBegin += laneSumBlockSize) {
+		std::size_t blockEnd = std::min(lanes.size(), blockBegin + laneSumBlockSize);
+		long long blockSum = 0;
+		for (std::size_t i = blockBegin; i < blockEnd; ++i)
+			blockSum += lanes[i];
+		result += blockSum;
+	}
+	for (std::size_t i = 0; i < overflowValues.size(); ++i)
+		result += overflowValues[i];
+	return result;
+}
+
+bool BigIntBatch::TryGetLaneValue(const BigInt& num, long long& value) {
+	const std::vector<int>& digits = num.reversedNumberAbsoluteValue;
+	if (digits.size() > 10)
+		return false;
+	value = 0;
+	for (std::size_t i = digits.size(); i-- > 0;)
+		value = value * 10 + digits[i];
+	if (value > laneLimit)
+		return false;
+	if (num.isNegative)
+		value = -value;
+	return true;
+}
+void BigIntBatch::SetOverflowResult(const std::size_t& index, const BigInt& num) {
+	long long value;
+	if (TryGetLaneValue(num, value))
+		lanes[index] = value;
+	else {
+		lanes[index] = 0;
+		isOverflowed[index] = 1;
+		overflowIndexes.push_back(index);
+		overflowValues.push_back(num);
+	}
+}
+void BigIntBatch::CheckSizes(const BigIntBatch& batch1, const BigIntBatch& batch2) {
+	if (batch1.lanes.size() != batch2.lanes.size())
+		throw std::invalid_argument("BigIntBatch: batches have different sizes");
+}
+void BigIntBatch::MarkOverflows(const BigIntBatch& batch1, const BigIntBatch& batch2, const std::vector<long long>& results, std::vector<unsigned char>& needsBigInt) {
+	std::size_t size = results.size();
+	needsBigInt.resize(size);
+	for (std::size_t i = 0; i < size; ++i)
+		needsBigInt[i] = batch1.isOverflowed[i] | batch2.isOverflowed[i] | (results[i] > laneLimit) | (results[i] < -laneLimit);
+}
@@ -0,0 +1,46 @@
+#include <BigIntExpression.h>
+
+BigInt BigIntFusedEvaluator::GetSum(const std::vector<BigIntFusedTerm>& terms) {
+	// каждое слагаемое по модулю меньше 10^size, а сумма terms.size() слагаемых - меньше 10^(size + количество цифр terms.size())
+	std::size_t size = 1;
+	// оценка модуля разряда буфера до переносов
+	unsigned long long maxColumn = 0;
+	for (std::size_t t = 0; t < terms.size(); ++t) {
+		std::size_t factor1Size = terms[t].factor1->size();
+		std::size_t factor2Size = (terms[t].factor2 != nullptr ? terms[t].factor2->size() : 0);
+		if (factor1Size + factor2Size > size)
+			size = factor1Size + factor2Size;
+		maxColumn += (terms[t].factor2 != nullptr ? 81ULL * (factor1Size < factor2Size ? factor1Size : factor2Size) : 9ULL);
+	}
+	for (std::size_t count = terms.size(); count > 0; count /= 10)
+		++size;
+	std::vector<int> digits;
+	bool isNegative;
+	// разряды в int складываются быстрее, long long нужен только для очень длинных столбцов
+	if (maxColumn < (unsigned long long)std::numeric_limits<int>::max() / 2)
+		isNegative = GetSumDigits<int>(terms, size, digits);
+	else
+		isNegative = GetSumDigits<long long>(terms, size, digits);
+	return BigInt(std::move(digits), isNegative);
+}
+BigIntFusedTerm BigIntFusedEvaluator::GetTerm(const BigInt& num, const bool& isNegative) {
+	BigIntFusedTerm term = { &num.reversedNumberAbsoluteValue.Get(), nullptr, isNegative != num.isNegative };
+	return term;
+}
+BigIntFusedTerm BigIntFusedEvaluator::GetTerm(const BigInt& num1, const BigInt& num2, const bool& isNegative) {
+	BigIntFusedTerm term = { &num1.reversedNumberAbsoluteValue.Get(), &num2.reversedNumberAbsoluteValue.Get(), isNegative != (num1.isNegative != num2.isNegative) };
+	return term;
+}
+
+BigIntLeaf::BigIntLeaf(const BigInt& inputValue) : value(inputValue) {
+}
+void BigIntLeaf::CollectTerms(std::vector<BigIntFusedTerm>& terms, const bool& isNegative, BigIntTemporaries&) const {
+	terms.push_back(BigIntFusedEvaluator::GetTerm(value, isNegative));
+}
+const BigInt& BigIntLeaf::GetFactor(BigIntTemporaries&) const {
+	return value;
+}
+
+BigIntLeaf Fuse(const BigInt& num) {
+	return BigIntLeaf(num);
+}
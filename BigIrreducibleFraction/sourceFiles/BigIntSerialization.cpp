@@ -0,0 +1,67 @@
+#include <BigIntSerialization.h>
+
+void BigIntSerialization::AppendVarint(std::string& buffer, unsigned long long value) {
+	while (value >= 0x80) {
+		buffer.push_back((char)((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	buffer.push_back((char)value);
+}
+void BigIntSerialization::AppendNumber(std::string& buffer, const BigInt& num, const bool& isDigitsIncluded) {
+	const SharedDigits& digits = num.reversedNumberAbsoluteValue;
+	bool isZero = ((digits.size() == 1) && (digits[0] == 0));
+	AppendVarint(buffer, (isZero ? 0 : ((unsigned long long)digits.size() << 1) | (num.isNegative ? 1 : 0)));
+	if (!isDigitsIncluded || isZero)
+		return;
+	for (std::size_t i = 0; i < digits.size(); i += 2)
+		buffer.push_back((char)(digits[i] | ((i + 1 < digits.size() ? digits[i + 1] : 0) << 4)));
+}
+void BigIntSerialization::AppendFraction(std::string& buffer, const BigIrreducibleFraction& num) {
+	AppendNumber(buffer, num.GetNumerator());
+	AppendNumber(buffer, num.GetDenominator());
+}
+unsigned long long BigIntSerialization::ReadVarint(const char*& position, const char* end) {
+	unsigned long long value = 0;
+	for (unsigned shift = 0; shift < 64; shift += 7) {
+		if (position == end)
+			throw std::invalid_argument("BigIntSerialization: truncated varint");
+		unsigned char byte = (unsigned char)*position++;
+		value |= (unsigned long long)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+			return value;
+	}
+	throw std::invalid_argument("BigIntSerialization: varint is too long");
+}
+BigInt BigIntSerialization::ReadNumber(const char*& position, const char* end) {
+	unsigned long long header = ReadVarint(position, end);
+	unsigned long long digitsCount = header >> 1;
+	if (digitsCount == 0)
+		return BigInt();
+	return BigInt(ReadDigits(position, end, digitsCount), (header & 1) != 0);
+}
+std::vector<int> BigIntSerialization::ReadDigits(const char*& position, const char* end, const unsigned long long& digitsCount) {
+	unsigned long long packedDigitsCount = (digitsCount + 1) / 2;
+	if ((unsigned long long)(end - position) < packedDigitsCount)
+		throw std::invalid_argument("BigIntSerialization: truncated number");
+	std::vector<int> reversedDigits;
+	reversedDigits.reserve(2 * packedDigitsCount);
+	for (unsigned long long i = 0; i < packedDigitsCount; ++i) {
+		unsigned char packedDigit = (unsigned char)*position++;
+		reversedDigits.push_back(packedDigit & 0x0F);
+		reversedDigits.push_back(packedDigit >> 4);
+	}
+	reversedDigits.resize(digitsCount);
+	for (const int& digit : reversedDigits)
+		if (digit > 9)
+			throw std::invalid_argument("BigIntSerialization: corrupted digits");
+	return reversedDigits;
+}
+BigIrreducibleFraction BigIntSerialization::ReadFraction(const char*& position, const char* end, const bool& isTrustedReduced) {
+	BigInt numerator = ReadNumber(position, end);
+	BigInt denominator = ReadNumber(position, end);
+	if (isTrustedReduced)
+		return BigIrreducibleFraction::CreateFromReduced(numerator, denominator);
+	if (denominator == 0)
+		throw std::invalid_argument("BigIntSerialization: zero denominator");
+	return BigIrreducibleFraction(numerator, denominator);
+}
@@ -0,0 +1,433 @@
+#include <BigIrreducibleFraction.h>
+
+namespace std {
+	std::size_t hash<BigIrreducibleFraction>::operator()(const BigIrreducibleFraction& num) const noexcept {
+		return num.GetHash();
+	}
+}
+
+BigIrreducibleFraction BigIrreducibleFraction::Reduce(BigIrreducibleFraction num) {
+	BIGINT_INSTRUMENT_KERNEL(FractionReduction, num.numerator.reversedNumberAbsoluteValue.size() + num.denominator.reversedNumberAbsoluteValue.size());
+	LatencyScope latencyScope(TracedOperation::FractionReduction, num.numerator.reversedNumberAbsoluteValue.size() + num.denominator.reversedNumberAbsoluteValue.size());
+	BigInt nod = 1;
+	do {
+		BigInt numNumeratorCopy = (num.numerator > 0 ? num.numerator : -num.numerator);
+		BigInt numDenominatorCopy = (num.denominator > 0 ? num.denominator : -num.denominator);
+		while ((numNumeratorCopy != 0) && (numDenominatorCopy != 0)) {
+			BIGINT_INSTRUMENT_ITERATION(FractionReduction);
+			if (numNumeratorCopy > numDenominatorCopy)
+				numNumeratorCopy %= numDenominatorCopy;
+			else
+				numDenominatorCopy %= numNumeratorCopy;
+		}
+		BigInt nod = numNumeratorCopy + numDenominatorCopy;
+		num.numerator /= nod;
+		num.denominator /= nod;
+	} while (nod != 1);
+	if (num.denominator < 0)
+		num *= BigIrreducibleFraction(-1, 1);
+	return num;
+}
+BigIrreducibleFraction::BigIrreducibleFraction() {
+	numerator = 0;
+	denominator = 1;
+}
+BigIrreducibleFraction::BigIrreducibleFraction(const std::string& irreducibleFraction) {
+	int forwardSlashPos = irreducibleFraction.find('/');
+	if (forwardSlashPos == std::string::npos) {
+		numerator = irreducibleFraction;
+		denominator = 1;
+	}
+	else {
+		numerator = irreducibleFraction.substr(0, forwardSlashPos);
+		denominator = irreducibleFraction.substr(forwardSlashPos + 1, irreducibleFraction.length() - forwardSlashPos - 1);
+	}
+	BIGINT_INSTRUMENT_KERNEL(FractionReduction, numerator.reversedNumberAbsoluteValue.size() + denominator.reversedNumberAbsoluteValue.size());
+	LatencyScope latencyScope(TracedOperation::FractionReduction, numerator.reversedNumberAbsoluteValue.size() + denominator.reversedNumberAbsoluteValue.size());
+	WorkloadRecordingScope recordingScope(RecordedOperation::FractionReduction, { numerator, denominator });
+	BigInt nod = 1;
+	do {
+		BigInt numNumeratorCopy = (numerator > 0 ? numerator : -numerator);
+		BigInt numDenominatorCopy = (denominator > 0 ? denominator : -denominator);
+		while ((numNumeratorCopy != 0) && (numDenominatorCopy != 0)) {
+			BIGINT_INSTRUMENT_ITERATION(FractionReduction);
+			if (numNumeratorCopy > numDenominatorCopy)
+				numNumeratorCopy %= numDenominatorCopy;
+			else
+				numDenominatorCopy %= numNumeratorCopy;
+		}
+		BigInt nod = numNumeratorCopy + numDenominatorCopy;
+		numerator /= nod;
+		denominator /= nod;
+	} while (nod != 1);
+	if (denominator < 0) {
+		numerator *= -1;
+		denominator *= -1;
+	}
+}
+BigIrreducibleFraction::BigIrreducibleFraction(const BigInt& inNumerator, const BigInt& inDenominator) {
+	numerator = inNumerator;
+	denominator = inDenominator;
+	BIGINT_INSTRUMENT_KERNEL(FractionReduction, numerator.reversedNumberAbsoluteValue.size() + denominator.reversedNumberAbsoluteValue.size());
+	LatencyScope latencyScope(TracedOperation::FractionReduction, numerator.reversedNumberAbsoluteValue.size() + denominator.reversedNumberAbsoluteValue.size());
+	WorkloadRecordingScope recordingScope(RecordedOperation::FractionReduction, { numerator, denominator });
+	BigInt nod = 1;
+	do {
+		BigInt numNumeratorCopy = (numerator > 0 ? numerator : -numerator);
+		BigInt numDenominatorCopy = (denominator > 0 ? denominator : -denominator);
+		while ((numNumeratorCopy != 0) && (numDenominatorCopy != 0)) {
+			BIGINT_INSTRUMENT_ITERATION(FractionReduction);
+			if (numNumeratorCopy > numDenominatorCopy)
+				numNumeratorCopy %= numDenominatorCopy;
+			else
+				numDenominatorCopy %= numNumeratorCopy;
+		}
+		BigInt nod = numNumeratorCopy + numDenominatorCopy;
+		numerator /= nod;
+		denominator /= nod;
+	} while (nod != 1);
+	if (denominator < 0) {
+		numerator *= -1;
+		denominator *= -1;
+	}
+}
+BigIrreducibleFraction BigIrreducibleFraction::CreateFromReduced(const BigInt& inNumerator, const BigInt& inDenominator) {
+	BigIrreducibleFraction result;
+	result.numerator = inNumerator;
+	result.denominator = inDenominator;
+	return result;
+}
+
+BigIrreducibleFraction operator+(const BigIrreducibleFraction& summand1, const BigIrreducibleFraction& summand2) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::FractionSum, { summand1.numerator, summand1.denominator, summand2.numerator, summand2.denominator });
+	// числитель ad + bc собирается в одном буфере без промежуточных произведений
+	BigInt numerator = Fuse(summand1.numerator) * summand2.denominator + Fuse(summand1.denominator) * summand2.numerator;
+	return BigIrreducibleFraction::Reduce(BigIrreducibleFraction(numerator, summand1.denominator * summand2.denominator));
+}
+BigIrreducibleFraction operator-(const BigIrreducibleFraction& minuend, const BigIrreducibleFraction& subtrahend) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::FractionDifference, { minuend.numerator, minuend.denominator, subtrahend.numerator, subtrahend.denominator });
+	BigInt numerator = Fuse(minuend.numerator) * subtrahend.denominator - Fuse(minuend.denominator) * subtrahend.numerator;
+	return BigIrreducibleFraction::Reduce(BigIrreducibleFraction(numerator, minuend.denominator * subtrahend.denominator));
+}
+BigIrreducibleFraction operator*(const BigIrreducibleFraction& multiplier1, const BigIrreducibleFraction& multiplier2) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::FractionProduct, { multiplier1.numerator, multiplier1.denominator, multiplier2.numerator, multiplier2.denominator });
+	return BigIrreducibleFraction::Reduce(BigIrreducibleFraction(multiplier1.numerator * multiplier2.numerator, multiplier1.denominator * multiplier2.denominator));
+}
+BigIrreducibleFraction operator/(const BigIrreducibleFraction& dividend, const BigIrreducibleFraction& divisor) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::FractionQuotient, { dividend.numerator, dividend.denominator, divisor.numerator, divisor.denominator });
+	return BigIrreducibleFraction::Reduce(BigIrreducibleFraction(dividend.numerator * divisor.denominator, dividend.denominator * divisor.numerator));
+}
+BigIrreducibleFraction& BigIrreducibleFraction::operator+=(const BigIrreducibleFraction& summand) {
+	return *this = *this + summand;
+}
+BigIrreducibleFraction& BigIrreducibleFraction::operator-=(const BigIrreducibleFraction& subtrahend) {
+	return *this = *this - subtrahend;
+}
+BigIrreducibleFraction& BigIrreducibleFraction::operator*=(const BigIrreducibleFraction& multiplier) {
+	return *this = *this * multiplier;
+}
+BigIrreducibleFraction& BigIrreducibleFraction::operator/=(const BigIrreducibleFraction& divisor) {
+	return *this = *this / divisor;
+}
+BigIrreducibleFraction& BigIrreducibleFraction::operator++() {
+	BigIrreducibleFraction one(1, 1);
+	return *this = *this + one;
+}
+BigIrreducibleFraction& BigIrreducibleFraction::operator--() {
+	BigIrreducibleFraction one(1, 1);
+	return *this = *this - one;
+}
+BigIrreducibleFraction BigIrreducibleFraction::operator++(int) {
+	BigIrreducibleFraction temp = *this;
+	++*this;
+	return temp;
+}
+BigIrreducibleFraction BigIrreducibleFraction::operator--(int) {
+	BigIrreducibleFraction temp = *this;
+	--*this;
+	return temp;
+}
+BigIrreducibleFraction BigIrreducibleFraction::operator+() const {
+	return *this;
+}
+BigIrreducibleFraction BigIrreducibleFraction::operator-() const {
+	// смена знака не нарушает несократимость
+	return CreateFromReduced(-numerator, denominator);
+}
+bool operator<(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) {
+	return BigIrreducibleFraction::GetCompareResult(num1, num2) < 0;
+}
+bool operator<=(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) {
+	return BigIrreducibleFraction::GetCompareResult(num1, num2) <= 0;
+}
+bool operator>(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) {
+	return BigIrreducibleFraction::GetCompareResult(num1, num2) > 0;
+}
+bool operator>=(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) {
+	return BigIrreducibleFraction::GetCompareResult(num1, num2) >= 0;
+}
+bool operator==(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) noexcept {
+	// дроби несократимы и знаменатели положительны, поэтому равные дроби совпадают почленно
+	return (num1.numerator == num2.numerator) && (num1.denominator == num2.denominator);
+}
+bool operator!=(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) noexcept {
+	return !(num1 == num2);
+}
+int BigIrreducibleFraction::GetCompareResult(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2) {
+	WorkloadRecordingScope recordingScope(RecordedOperation::FractionCompare, { num1.numerator, num1.denominator, num2.numerator, num2.denominator });
+	// знаменатели положительны, поэтому знак a/b - c/d совпадает со знаком ad - cb, который считается без сокращения
+	if (num1.denominator == num2.denominator)
+		return BigInt::GetCompareResult(num1.numerator, num2.numerator);
+	BigInt difference = Fuse(num1.numerator) * num2.denominator - Fuse(num2.numerator) * num1.denominator;
+	return (difference.isNegative ? -1 : (difference == 0 ? 0 : 1));
+}
+std::size_t BigIrreducibleFraction::GetHash() const noexcept {
+	std::size_t numeratorHash = numerator.GetHash();
+	return numeratorHash ^ (denominator.GetHash() + 0x9E3779B97F4A7C15ULL + (numeratorHash << 6) + (numeratorHash >> 2));
+}
+BigIrreducibleFraction& BigIrreducibleFraction::operator=(const std::string& irreducibleFraction){
+	// дробь сокращается так же, как в конструкторе, иначе сравнение и хэш почленно были бы неверны
+	*this = BigIrreducibleFraction(irreducibleFraction);
+	return *this;
+}
+const BigInt& BigIrreducibleFraction::GetNumerator() const {
+	return numerator;
+}
+const BigInt& BigIrreducibleFraction::GetDenominator() const {
+	return denominator;
+}
+double BigIrreducibleFraction::ToDouble() const {
+	return ToFloatingPoint<double>();
+}
+long double BigIrreducibleFraction::ToLongDouble() const {
+	return ToFloatingPoint<long double>();
+}
+std::string BigIrreducibleFraction::ToDecimalString(const std::size_t& inputSignificantDigitsCount) const {
+	std::size_t significantDigitsCount = (inputSignificantDigitsCount == 0 ? 1 : inputSignificantDigitsCount);
+	std::string digits(significantDigitsCount, '0');
+	long long decimalExponent = 0;
+	if (numerator != 0) {
+		// уточняем оценку, пока округления нижней и верхней границ не совпадут
+		for (std::size_t precision = significantDigitsCount + 8;; precision *= 2) {
+			BigInt lower, upper;
+			long long exponent;
+			GetDecimalBounds(precision, lower, upper, exponent);
+			std::ostringstream lowerStream, upperStream;
+			lowerStream << lower;
+			upperStream << upper;
+			long long upperDecimalExponent;
+			digits = GetRoundedDigits(lowerStream.str(), exponent, significantDigitsCount, decimalExponent);
+			if ((GetRoundedDigits(upperStream.str(), exponent, significantDigitsCount, upperDecimalExponent) == digits) && (upperDecimalExponent == decimalExponent))
+				break;
+		}
+	}
+	std::string result = (numerator.isNegative ? "-" : "");
+	if ((decimalExponent < -4) || (decimalExponent >= (long long)significantDigitsCount)) {
+		// экспоненциальная запись d.ddde+XX
+		result += digits[0];
+		if (significantDigitsCount > 1)
+			result += "." + digits.substr(1);
+		std::string exponentDigits = std::to_string(decimalExponent < 0 ? -decimalExponent : decimalExponent);
+		result += std::string(decimalExponent < 0 ? "e-" : "e+") + (exponentDigits.length() < 2 ? "0" : "") + exponentDigits;
+	}
+	else if (decimalExponent < 0)
+		result += "0." + std::string(-decimalExponent - 1, '0') + digits;
+	else {
+		result += digits.substr(0, decimalExponent + 1);
+		if (decimalExponent + 1 < (long long)significantDigitsCount)
+			result += "." + digits.substr(decimalExponent + 1);
+	}
+	return result;
+}
+BigIrreducibleFraction BigIrreducibleFraction::LimitDenominator(const BigInt& inputMaxDenominator) const {
+	BigInt maxDenominator = inputMaxDenominator;
+	if (maxDenominator < 1)
+		throw std::invalid_argument("BigIrreducibleFraction: max denominator must be positive");
+	if (BigInt::GetCompareResult(denominator, maxDenominator) <= 0)
+		return *this;
+	// подходящие дроби p0/q0 и p1/q1 строятся по элементам цепной дроби, пока знаменатель не превысит ограничение
+	BigInt previousNumerator = 0, previousDenominator = 1, currentNumerator = 1, currentDenominator = 0;
+	ContinuedFractionGenerator terms(*this);
+	while (terms.HasNextTerm()) {
+		BigInt term = terms.GetNextTerm();
+		BigInt nextDenominator = previousDenominator + term * currentDenominator;
+		if (nextDenominator > maxDenominator)
+			break;
+		BigInt nextNumerator = previousNumerator + term * currentNumerator;
+		previousNumerator = currentNumerator;
+		previousDenominator = currentDenominator;
+		currentNumerator = nextNumerator;
+		currentDenominator = nextDenominator;
+	}
+	// лучшее приближение - либо последняя подходящая дробь, либо промежуточная дробь с наибольшим допустимым знаменателем
+	BigInt steps = (maxDenominator - previousDenominator) / currentDenominator;
+	BigIrreducibleFraction semiconvergent(previousNumerator + steps * currentNumerator, previousDenominator + steps * currentDenominator);
+	BigIrreducibleFraction convergent(currentNumerator, currentDenominator);
+	BigIrreducibleFraction self = *this;
+	BigIrreducibleFraction convergentDistance = convergent - self;
+	BigIrreducibleFraction semiconvergentDistance = semiconvergent - self;
+	if (convergentDistance.numerator < 0)
+		convergentDistance = -convergentDistance;
+	if (semiconvergentDistance.numerator < 0)
+		semiconvergentDistance = -semiconvergentDistance;
+	return (convergentDistance <= semiconvergentDistance ? convergent : semiconvergent);
+}
+bool BigIrreducibleFraction::TryGetSquareRoot(BigIrreducibleFraction& root) const {
+	// сначала дешевые проверки остатков обоих чисел, корни считаются только после них
+	if ((numerator < 0) || !BigInt::IsPossibleSquare(numerator) || !BigInt::IsPossibleSquare(denominator))
+		return false;
+	BigInt numeratorRoot = BigInt::GetSquareRoot(numerator);
+	if (numeratorRoot * numeratorRoot != numerator)
+		return false;
+	BigInt denominatorRoot = BigInt::GetSquareRoot(denominator);
+	if (denominatorRoot * denominatorRoot != denominator)
+		return false;
+	// корни взаимно простых чисел взаимно просты
+	root = CreateFromReduced(numeratorRoot, denominatorRoot);
+	return true;
+}
+std::ostream& operator<<(std::ostream& os, const BigIrreducibleFraction& num) {
+	os << num.numerator << '/' << num.denominator;
+	return os;
+}
+
+void BigIrreducibleFraction::GetDecimalBounds(const std::size_t& precision, BigInt& lower, BigInt& upper, long long& exponent) const {
+	const std::vector<int>& numeratorDigits = numerator.reversedNumberAbsoluteValue;
+	const std::vector<int>& denominatorDigits = denominator.reversedNumberAbsoluteValue;
+	// отбрасываем младшие цифры, оставляя precision старших, и запоминаем, были ли отброшены ненулевые цифры
+	std::size_t numeratorDroppedCount = (numeratorDigits.size() > precision ? numeratorDigits.size() - precision : 0);
+	std::size_t denominatorDroppedCount = (denominatorDigits.size() > precision ? denominatorDigits.size() - precision : 0);
+	bool isNumeratorTruncated = false;
+	for (std::size_t i = 0; i < numeratorDroppedCount; ++i)
+		isNumeratorTruncated = (isNumeratorTruncated || (numeratorDigits[i] != 0));
+	bool isDenominatorTruncated = false;
+	for (std::size_t i = 0; i < denominatorDroppedCount; ++i)
+		isDenominatorTruncated = (isDenominatorTruncated || (denominatorDigits[i] != 0));
+	BigInt denominatorTop(std::vector<int>(denominatorDigits.begin() + denominatorDroppedCount, denominatorDigits.end()), false);
+	// сдвиг числителя на shift разрядов, чтобы частное имело не меньше precision цифр
+	std::size_t shift = precision + denominatorTop.reversedNumberAbsoluteValue.size();
+	std::vector<int> shiftedNumeratorTop(shift, 0);
+	shiftedNumeratorTop.insert(shiftedNumeratorTop.end(), numeratorDigits.begin() + numeratorDroppedCount, numeratorDigits.end());
+	BigInt lowerNumerator(shiftedNumeratorTop, false);
+	BigInt lowerDenominator = denominatorTop + (isDenominatorTruncated ? 1 : 0);
+	lower = lowerNumerator / lowerDenominator;
+	BigInt upperNumerator = lowerNumerator;
+	if (isNumeratorTruncated) {
+		std::vector<int> unit(shift, 0);
+		unit.push_back(1);
+		upperNumerator += BigInt(unit, false);
+	}
+	upper = upperNumerator / denominatorTop;
+	if (isNumeratorTruncated || isDenominatorTruncated || (upper * denominatorTop != upperNumerator))
+		++upper;
+	exponent = (long long)numeratorDroppedCount - (long long)denominatorDroppedCount - (long long)shift;
+}
+std::string BigIrreducibleFraction::GetRoundedDigits(const std::string& digits, const long long& exponent, const std::size_t& significantDigitsCount, long long& decimalExponent) {
+	decimalExponent = exponent + (long long)digits.length() - 1;
+	if (digits.length() <= significantDigitsCount)
+		return digits + std::string(significantDigitsCount - digits.length(), '0');
+	std::string roundedDigits = digits.substr(0, significantDigitsCount);
+	if (digits[significantDigitsCount] >= '5') {
+		// прибавление единицы к последней цифре с переносом
+		int i = significantDigitsCount - 1;
+		while ((i >= 0) && (roundedDigits[i] == '9'))
+			roundedDigits[i--] = '0';
+		if (i >= 0)
+			roundedDigits[i]++;
+		else {
+			roundedDigits = "1" + roundedDigits.substr(0, significantDigitsCount - 1);
+			decimalExponent++;
+		}
+	}
+	return roundedDigits;
+}
+void BigIrreducibleFraction::ParseFloatingPoint(const std::string& decimal, double& result) {
+	result = std::strtod(decimal.c_str(), nullptr);
+}
+void BigIrreducibleFraction::ParseFloatingPoint(const std::string& decimal, long double& result) {
+	result = std::strtold(decimal.c_str(), nullptr);
+}
+ContinuedFractionGenerator BigIrreducibleFraction::GetContinuedFraction() const {
+	return ContinuedFractionGenerator(*this);
+}
+
+ContinuedFractionGenerator::ContinuedFractionGenerator(const BigIrreducibleFraction& num) {
+	// целая часть с округлением вниз, дальше алгоритм Евклида для знаменателя и остатка
+	BigInt numerator = num.GetNumerator();
+	divisor = num.GetDenominator();
+	BigInt integerPart = numerator / divisor;
+	dividend = numerator - integerPart * divisor;
+	if (dividend < 0) {
+		--integerPart;
+		dividend += divisor;
+	}
+	pendingTerms.push_back(integerPart);
+	std::swap(dividend, divisor);
+}
+bool ContinuedFractionGenerator::HasNextTerm() const {
+	return (!pendingTerms.empty()) || (divisor != 0);
+}
+BigInt ContinuedFractionGenerator::GetNextTerm() {
+	if (!HasNextTerm())
+		throw std::out_of_range("ContinuedFractionGenerator: no more terms");
+	if (pendingTerms.empty())
+		FindNextTerms();
+	BigInt term = pendingTerms.front();
+	pendingTerms.pop_front();
+	return term;
+}
+void ContinuedFractionGenerator::FindNextTerms() {
+	std::size_t dividendDigitsCount = dividend.reversedNumberAbsoluteValue.size();
+	if (dividendDigitsCount <= lehmerDigitsCount) {
+		// числа помещаются в long long, доводим алгоритм Евклида до конца без BigInt
+		long long smallDividend = GetDigitsFrom(dividend, 0), smallDivisor = GetDigitsFrom(divisor, 0);
+		while (smallDivisor != 0) {
+			pendingTerms.push_back(BigInt(smallDividend / smallDivisor));
+			long long remainder = smallDividend % smallDivisor;
+			smallDividend = smallDivisor;
+			smallDivisor = remainder;
+		}
+		dividend = smallDividend;
+		divisor = 0;
+		return;
+	}
+	// шаг Лемера (Кнут, алгоритм L): элемент принимается, только если он одинаков для обеих границ старших цифр
+	std::size_t shift = dividendDigitsCount - lehmerDigitsCount;
+	long long dividendTop = GetDigitsFrom(dividend, shift), divisorTop = GetDigitsFrom(divisor, shift);
+	long long a = 1, b = 0, c = 0, d = 1;
+	while ((divisorTop + c > 0) && (divisorTop + d > 0)) {
+		long long quotient = (dividendTop + a) / (divisorTop + c);
+		if (quotient != (dividendTop + b) / (divisorTop + d))
+			break;
+		pendingTerms.push_back(BigInt(quotient));
+		long long temp = a - quotient * c;
+		a = c;
+		c = temp;
+		temp = b - quotient * d;
+		b = d;
+		d = temp;
+		temp = dividendTop - quotient * divisorTop;
+		dividendTop = divisorTop;
+		divisorTop = temp;
+	}
+	if (b == 0) {
+		// по старшим цифрам ни одного элемента не нашлось, делаем обычный шаг с делением
+		BigInt quotient = dividend / divisor;
+		BigInt remainder = dividend - quotient * divisor;
+		pendingTerms.push_back(quotient);
+		dividend = divisor;
+		divisor = remainder;
+		return;
+	}
+	// все найденные шаги применяются к большим числам сразу
+	BigInt newDividend = BigInt(a) * dividend + BigInt(b) * divisor;
+	BigInt newDivisor = BigInt(c) * dividend + BigInt(d) * divisor;
+	dividend = newDividend;
+	divisor = newDivisor;
+}
+long long ContinuedFractionGenerator::GetDigitsFrom(const BigInt& num, const std::size_t& shift) {
+	long long result = 0;
+	for (std::size_t i = num.reversedNumberAbsoluteValue.size(); i-- > shift;)
+		result = result * 10 + num.reversedNumberAbsoluteValue[i];
+	return result;
+}
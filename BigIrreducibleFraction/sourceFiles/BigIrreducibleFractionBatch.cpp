@@ -0,0 +1,159 @@
+#include <BigIrreducibleFractionBatch.h>
+
+BigIrreducibleFractionBatch::BigIrreducibleFractionBatch() {
+}
+BigIrreducibleFractionBatch::BigIrreducibleFractionBatch(const std::vector<BigIrreducibleFraction>& fractions) {
+	Reserve(fractions.size());
+	for (std::size_t i = 0; i < fractions.size(); ++i)
+		PushBack(fractions[i]);
+}
+std::size_t BigIrreducibleFractionBatch::GetSize() const {
+	return numeratorLanes.size();
+}
+void BigIrreducibleFractionBatch::Reserve(const std::size_t& size) {
+	numeratorLanes.reserve(size);
+	denominatorLanes.reserve(size);
+	isOverflowed.reserve(size);
+}
+void BigIrreducibleFractionBatch::PushBack(const BigIrreducibleFraction& fraction) {
+	numeratorLanes.push_back(0);
+	denominatorLanes.push_back(1);
+	isOverflowed.push_back(0);
+	SetOverflowResult(numeratorLanes.size() - 1, fraction);
+}
+BigIrreducibleFraction BigIrreducibleFractionBatch::Get(const std::size_t& index) const {
+	if (!isOverflowed[index])
+		return BigIrreducibleFraction::CreateFromReduced(numeratorLanes[index], denominatorLanes[index]);
+	std::size_t position = std::lower_bound(overflowIndexes.begin(), overflowIndexes.end(), index) - overflowIndexes.begin();
+	return overflowValues[position];
+}
+std::vector<BigIrreducibleFraction> BigIrreducibleFractionBatch::ToVector() const {
+	std::vector<BigIrreducibleFraction> result;
+	result.reserve(numeratorLanes.size());
+	for (std::size_t i = 0, position = 0; i < numeratorLanes.size(); ++i)
+		result.push_back(isOverflowed[i] ? overflowValues[position++] : BigIrreducibleFraction::CreateFromReduced(numeratorLanes[i], denominatorLanes[i]));
+	return result;
+}
+std::size_t BigIrreducibleFractionBatch::GetOverflowsCount() const {
+	return overflowValues.size();
+}
+
+BigIrreducibleFractionBatch BigIrreducibleFractionBatch::GetSum(const BigIrreducibleFractionBatch& batch1, const BigIrreducibleFractionBatch& batch2) {
+	CheckSizes(batch1, batch2);
+	std::size_t size = batch1.numeratorLanes.size();
+	// несокращенные суммы a/b + c/d = (ad + cb)/bd считаются векторизуемым циклом, модули дорожек не больше 2^31, поэтому переполнения нет
+	std::vector<long long> numerators(size), denominators(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		numerators[i] = batch1.numeratorLanes[i] * batch2.denominatorLanes[i] + batch2.numeratorLanes[i] * batch1.denominatorLanes[i];
+		denominators[i] = batch1.denominatorLanes[i] * batch2.denominatorLanes[i];
+	}
+	BigIrreducibleFractionBatch result;
+	result.numeratorLanes.resize(size);
+	result.denominatorLanes.resize(size);
+	result.isOverflowed.assign(size, 0);
+	for (std::size_t i = 0; i < size; ++i)
+		if (batch1.isOverflowed[i] | batch2.isOverflowed[i])
+			result.SetOverflowResult(i, batch1.Get(i) + batch2.Get(i));
+		else
+			result.SetLanesResult(i, numerators[i], denominators[i]);
+	return result;
+}
+BigIrreducibleFractionBatch BigIrreducibleFractionBatch::GetProduct(const BigIrreducibleFractionBatch& batch1, const BigIrreducibleFractionBatch& batch2) {
+	CheckSizes(batch1, batch2);
+	std::size_t size = batch1.numeratorLanes.size();
+	std::vector<long long> numerators(size), denominators(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		numerators[i] = batch1.numeratorLanes[i] * batch2.numeratorLanes[i];
+		denominators[i] = batch1.denominatorLanes[i] * batch2.denominatorLanes[i];
+	}
+	BigIrreducibleFractionBatch result;
+	result.numeratorLanes.resize(size);
+	result.denominatorLanes.resize(size);
+	result.isOverflowed.assign(size, 0);
+	for (std::size_t i = 0; i < size; ++i)
+		if (batch1.isOverflowed[i] | batch2.isOverflowed[i])
+			result.SetOverflowResult(i, batch1.Get(i) * batch2.Get(i));
+		else
+			result.SetLanesResult(i, numerators[i], denominators[i]);
+	return result;
+}
+std::vector<int> BigIrreducibleFractionBatch::GetCompareResults(const BigIrreducibleFractionBatch& batch1, const BigIrreducibleFractionBatch& batch2) {
+	CheckSizes(batch1, batch2);
+	std::size_t size = batch1.numeratorLanes.size();
+	std::vector<int> result(size);
+	// знаменатели положительны, поэтому a/b и c/d сравниваются как ad и cb
+	for (std::size_t i = 0; i < size; ++i) {
+		long long left = batch1.numeratorLanes[i] * batch2.denominatorLanes[i];
+		long long right = batch2.numeratorLanes[i] * batch1.denominatorLanes[i];
+		result[i] = (left > right) - (left < right);
+	}
+	for (std::size_t i = 0; i < size; ++i)
+		if (batch1.isOverflowed[i] | batch2.isOverflowed[i]) {
+			result[i] = BigIrreducibleFraction::GetCompareResult(batch1.Get(i), batch2.Get(i));
+		}
+	return result;
+}
+BigIrreducibleFraction BigIrreducibleFractionBatch::GetTotalSum() const {
+	// сумма копится в дорожках, пока помещается в BigIntBatch::laneLimit, затем переносится в BigIrreducibleFraction
+	BigIrreducibleFraction result;
+	long long numerator = 0, denominator = 1;
+	for (std::size_t i = 0; i < numeratorLanes.size(); ++i) {
+		if (denominator == denominatorLanes[i])
+			numerator += numeratorLanes[i];
+		else {
+			numerator = numerator * denominatorLanes[i] + numeratorLanes[i] * denominator;
+			denominator *= denominatorLanes[i];
+		}
+		ReduceLanes(numerator, denominator);
+		if ((numerator > BigIntBatch::laneLimit) || (numerator < -BigIntBatch::laneLimit) || (denominator > BigIntBatch::laneLimit)) {
+			result += BigIrreducibleFraction::CreateFromReduced(numerator, denominator);
+			numerator = 0;
+			denominator = 1;
+		}
+	}
+	result += BigIrreducibleFraction::CreateFromReduced(numerator, denominator);
+	for (std::size_t i = 0; i < overflowValues.size(); ++i)
+		result += overflowValues[i];
+	return result;
+}
+
+void BigIrreducibleFractionBatch::ReduceLanes(long long& numerator, long long& denominator) {
+	long long dividend = (numerator < 0 ? -numerator : numerator);
+	long long divisor = denominator;
+	while (divisor != 0) {
+		long long remainder = dividend % divisor;
+		dividend = divisor;
+		divisor = remainder;
+	}
+	if (dividend > 1) {
+		numerator /= dividend;
+		denominator /= dividend;
+	}
+}
+void BigIrreducibleFractionBatch::SetLanesResult(const std::size_t& index, long long numerator, long long denominator) {
+	ReduceLanes(numerator, denominator);
+	if ((numerator > BigIntBatch::laneLimit) || (numerator < -BigIntBatch::laneLimit) || (denominator > BigIntBatch::laneLimit))
+		SetOverflowResult(index, BigIrreducibleFraction::CreateFromReduced(numerator, denominator));
+	else {
+		numeratorLanes[index] = numerator;
+		denominatorLanes[index] = denominator;
+	}
+}
+void BigIrreducibleFractionBatch::SetOverflowResult(const std::size_t& index, const BigIrreducibleFraction& fraction) {
+	long long numerator, denominator;
+	if (BigIntBatch::TryGetLaneValue(fraction.GetNumerator(), numerator) && BigIntBatch::TryGetLaneValue(fraction.GetDenominator(), denominator)) {
+		numeratorLanes[index] = numerator;
+		denominatorLanes[index] = denominator;
+	}
+	else {
+		numeratorLanes[index] = 0;
+		denominatorLanes[index] = 1;
+		isOverflowed[index] = 1;
+		overflowIndexes.push_back(index);
+		overflowValues.push_back(fraction);
+	}
+}
+void BigIrreducibleFractionBatch::CheckSizes(const BigIrreducibleFractionBatch& batch1, const BigIrreducibleFractionBatch& batch2) {
+	if (batch1.numeratorLanes.size() != batch2.numeratorLanes.size())
+		throw std::invalid_argument("BigIrreducibleFractionBatch: batches have different sizes");
+}
@@ -0,0 +1,126 @@
+#include <BigIrreducibleFractionFileParser.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::vector<BigIrreducibleFraction> BigIrreducibleFractionFileParser::ParseFile(const std::string& path, const bool& isTrustedReduced) {
+#if defined(__unix__) || defined(__APPLE__)
+	int fileDescriptor = open(path.c_str(), O_RDONLY);
+	if (fileDescriptor < 0)
+		throw std::runtime_error("BigIrreducibleFractionFileParser: cannot open " + path);
+	struct stat fileStat;
+	if (fstat(fileDescriptor, &fileStat) != 0) {
+		close(fileDescriptor);
+		throw std::runtime_error("BigIrreducibleFractionFileParser: cannot stat " + path);
+	}
+	std::size_t fileSize = fileStat.st_size;
+	if (fileSize == 0) {
+		close(fileDescriptor);
+		return std::vector<BigIrreducibleFraction>();
+	}
+	void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+	close(fileDescriptor);
+	if (mapping == MAP_FAILED)
+		throw std::runtime_error("BigIrreducibleFractionFileParser: cannot map " + path);
+	// файл читается последовательно каждым потоком
+	madvise(mapping, fileSize, MADV_SEQUENTIAL);
+	const char* text = static_cast<const char*>(mapping);
+	try {
+		std::vector<BigIrreducibleFraction> result = ParseText(text, text + fileSize, isTrustedReduced);
+		munmap(mapping, fileSize);
+		return result;
+	}
+	catch (...) {
+		munmap(mapping, fileSize);
+		throw;
+	}
+#else
+	// без mmap файл читается в память целиком
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		throw std::runtime_error("BigIrreducibleFractionFileParser: cannot open " + path);
+	std::vector<char> text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	return ParseText(text.data(), text.data() + text.size(), isTrustedReduced);
+#endif
+}
+std::vector<BigIrreducibleFraction> BigIrreducibleFractionFileParser::ParseText(const char* begin, const char* end, const bool& isTrustedReduced) {
+	// границы кусков сдвигаются вперед до ближайшего перевода строки
+	std::size_t chunksCount = (end - begin) / minimalChunkSize + 1;
+	std::size_t threadsCount = std::thread::hardware_concurrency();
+	if (chunksCount > 4 * threadsCount)
+		chunksCount = 4 * threadsCount;
+	if (chunksCount == 0)
+		chunksCount = 1;
+	std::vector<const char*> chunkBegins;
+	chunkBegins.push_back(begin);
+	for (std::size_t i = 1; i < chunksCount; ++i) {
+		const char* chunkBegin = begin + (end - begin) * i / chunksCount;
+		if (chunkBegin < chunkBegins.back())
+			chunkBegin = chunkBegins.back();
+		while ((chunkBegin != end) && (chunkBegin[-1] != '\n'))
+			++chunkBegin;
+		chunkBegins.push_back(chunkBegin);
+	}
+	chunkBegins.push_back(end);
+	std::vector<std::vector<BigIrreducibleFraction>> chunkResults(chunksCount);
+	ParallelFor(0, chunksCount, [&](std::size_t i) {
+		ParseChunk(chunkBegins[i], chunkBegins[i + 1], isTrustedReduced, chunkResults[i]);
+	});
+	// сборка результатов кусков в один непрерывный вектор
+	std::size_t fractionsCount = 0;
+	for (std::size_t i = 0; i < chunksCount; ++i)
+		fractionsCount += chunkResults[i].size();
+	std::vector<BigIrreducibleFraction> result;
+	result.reserve(fractionsCount);
+	for (std::size_t i = 0; i < chunksCount; ++i) {
+		result.insert(result.end(), std::make_move_iterator(chunkResults[i].begin()), std::make_move_iterator(chunkResults[i].end()));
+		std::vector<BigIrreducibleFraction>().swap(chunkResults[i]);
+	}
+	return result;
+}
+
+void BigIrreducibleFractionFileParser::ParseChunk(const char* begin, const char* end, const bool& isTrustedReduced, std::vector<BigIrreducibleFraction>& result) {
+	const char* lineBegin = begin;
+	while (lineBegin != end) {
+		const char* lineEnd = lineBegin;
+		while ((lineEnd != end) && (*lineEnd != '\n'))
+			++lineEnd;
+		const char* nextLineBegin = (lineEnd == end ? end : lineEnd + 1);
+		// обрезка пробелов и '\r' по краям строки
+		while ((lineBegin != lineEnd) && ((*lineBegin == ' ') || (*lineBegin == '\t') || (*lineBegin == '\r')))
+			++lineBegin;
+		while ((lineEnd != lineBegin) && ((lineEnd[-1] == ' ') || (lineEnd[-1] == '\t') || (lineEnd[-1] == '\r')))
+			--lineEnd;
+		if (lineBegin != lineEnd)
+			result.push_back(ParseLine(lineBegin, lineEnd, isTrustedReduced));
+		lineBegin = nextLineBegin;
+	}
+}
+BigIrreducibleFraction BigIrreducibleFractionFileParser::ParseLine(const char* begin, const char* end, const bool& isTrustedReduced) {
+	const char* forwardSlash = begin;
+	while ((forwardSlash != end) && (*forwardSlash != '/'))
+		++forwardSlash;
+	const char* denominatorBegin = (forwardSlash == end ? end : forwardSlash + 1);
+	if (!IsInteger(begin, forwardSlash) || ((forwardSlash != end) && (!IsInteger(denominatorBegin, end))))
+		throw std::invalid_argument("BigIrreducibleFractionFileParser: malformed fraction " + std::string(begin, end));
+	BigInt numerator(begin, forwardSlash);
+	BigInt denominator = (forwardSlash == end ? BigInt(1) : BigInt(denominatorBegin, end));
+	if (denominator == 0)
+		throw std::invalid_argument("BigIrreducibleFractionFileParser: zero denominator in " + std::string(begin, end));
+	if (isTrustedReduced)
+		return BigIrreducibleFraction::CreateFromReduced(numerator, denominator);
+	return BigIrreducibleFraction(numerator, denominator);
+}
+bool BigIrreducibleFractionFileParser::IsInteger(const char* begin, const char* end) {
+	if ((begin != end) && (*begin == '-'))
+		++begin;
+	if (begin == end)
+		return false;
+	for (; begin != end; ++begin)
+		if ((*begin < '0') || (*begin > '9'))
+			return false;
+	return true;
+}
@@ -0,0 +1,168 @@
+#include <BigMatrix.h>
+
+BigMatrix::BigMatrix() {
+	rowsCount = 0;
+	columnsCount = 0;
+}
+BigMatrix::BigMatrix(const std::size_t& inputRowsCount, const std::size_t& inputColumnsCount) {
+	rowsCount = inputRowsCount;
+	columnsCount = inputColumnsCount;
+	elements.resize(rowsCount * columnsCount);
+}
+BigMatrix::BigMatrix(const std::vector<std::vector<BigIrreducibleFraction>>& rows) {
+	rowsCount = rows.size();
+	columnsCount = (rows.empty() ? 0 : rows[0].size());
+	elements.reserve(rowsCount * columnsCount);
+	for (std::size_t i = 0; i < rowsCount; ++i) {
+		if (rows[i].size() != columnsCount)
+			throw std::invalid_argument("BigMatrix: rows have different lengths");
+		elements.insert(elements.end(), rows[i].begin(), rows[i].end());
+	}
+}
+std::size_t BigMatrix::GetRowsCount() const {
+	return rowsCount;
+}
+std::size_t BigMatrix::GetColumnsCount() const {
+	return columnsCount;
+}
+BigIrreducibleFraction& BigMatrix::operator()(const std::size_t& row, const std::size_t& column) {
+	return elements[row * columnsCount + column];
+}
+const BigIrreducibleFraction& BigMatrix::operator()(const std::size_t& row, const std::size_t& column) const {
+	return elements[row * columnsCount + column];
+}
+
+BigIrreducibleFraction BigMatrix::GetDeterminant() const {
+	CheckSquare();
+	std::vector<BigInt> rowMultipliers;
+	std::vector<BigInt> matrix = GetIntegerAugmentedMatrix(std::vector<BigIrreducibleFraction>(), 0, rowMultipliers);
+	int swapsSign = 1;
+	if (!EliminateBareiss(matrix, rowsCount, rowsCount, swapsSign))
+		return BigIrreducibleFraction();
+	// определитель целочисленной матрицы равен последнему ведущему элементу с точностью до знака перестановки,
+	// определитель исходной матрицы получается делением на произведение множителей строк
+	BigInt multipliersProduct = 1;
+	for (std::size_t i = 0; i < rowsCount; ++i)
+		multipliersProduct *= rowMultipliers[i];
+	BigInt determinant = (rowsCount == 0 ? BigInt(1) : matrix[rowsCount * rowsCount - 1]);
+	return BigIrreducibleFraction(determinant * swapsSign, multipliersProduct);
+}
+std::vector<BigIrreducibleFraction> BigMatrix::Solve(const std::vector<BigIrreducibleFraction>& rightSide) const {
+	CheckSquare();
+	if (rightSide.size() != rowsCount)
+		throw std::invalid_argument("BigMatrix: right side size does not match matrix size");
+	std::vector<BigInt> rowMultipliers;
+	std::vector<BigInt> matrix = GetIntegerAugmentedMatrix(rightSide, 1, rowMultipliers);
+	int swapsSign = 1;
+	if (!EliminateBareiss(matrix, rowsCount, rowsCount + 1, swapsSign))
+		throw std::domain_error("BigMatrix: matrix is singular");
+	std::vector<BigInt> scaledSolution = SubstituteBackward(matrix, rowsCount, rowsCount + 1);
+	std::vector<BigIrreducibleFraction> solution;
+	if (rowsCount == 0)
+		return solution;
+	const BigInt& lastPivot = matrix[(rowsCount - 1) * (rowsCount + 1) + rowsCount - 1];
+	solution.reserve(rowsCount);
+	for (std::size_t i = 0; i < rowsCount; ++i)
+		solution.push_back(BigIrreducibleFraction(scaledSolution[i], lastPivot));
+	return solution;
+}
+BigMatrix BigMatrix::GetInverse() const {
+	CheckSquare();
+	// правая часть - единичная матрица; домножение ее строк на множители строк дает на выходе сразу обратную матрицу
+	std::vector<BigIrreducibleFraction> identity(rowsCount * rowsCount);
+	for (std::size_t i = 0; i < rowsCount; ++i)
+		identity[i * rowsCount + i] = BigIrreducibleFraction(1, 1);
+	std::vector<BigInt> rowMultipliers;
+	std::vector<BigInt> matrix = GetIntegerAugmentedMatrix(identity, rowsCount, rowMultipliers);
+	int swapsSign = 1;
+	std::size_t width = 2 * rowsCount;
+	if (!EliminateBareiss(matrix, rowsCount, width, swapsSign))
+		throw std::domain_error("BigMatrix: matrix is singular");
+	std::vector<BigInt> scaledInverse = SubstituteBackward(matrix, rowsCount, width);
+	BigMatrix inverse(rowsCount, rowsCount);
+	if (rowsCount == 0)
+		return inverse;
+	const BigInt& lastPivot = matrix[(rowsCount - 1) * width + rowsCount - 1];
+	ParallelFor(0, rowsCount, [&](std::size_t i) {
+		for (std::size_t j = 0; j < rowsCount; ++j)
+			inverse.elements[i * rowsCount + j] = BigIrreducibleFraction(scaledInverse[i * rowsCount + j], lastPivot);
+	}, parallelRowsChunkSize);
+	return inverse;
+}
+std::ostream& operator<<(std::ostream& os, const BigMatrix& matrix) {
+	for (std::size_t i = 0; i < matrix.rowsCount; ++i) {
+		for (std::size_t j = 0; j < matrix.columnsCount; ++j)
+			os << (j == 0 ? "" : " ") << matrix(i, j);
+		os << '\n';
+	}
+	return os;
+}
+
+void BigMatrix::CheckSquare() const {
+	if (rowsCount != columnsCount)
+		throw std::invalid_argument("BigMatrix: matrix is not square");
+}
+std::vector<BigInt> BigMatrix::GetIntegerAugmentedMatrix(const std::vector<BigIrreducibleFraction>& rightSide, const std::size_t& rightSideColumnsCount, std::vector<BigInt>& rowMultipliers) const {
+	std::size_t width = columnsCount + rightSideColumnsCount;
+	std::vector<BigInt> matrix(rowsCount * width);
+	rowMultipliers.assign(rowsCount, BigInt(1));
+	ParallelFor(0, rowsCount, [&](std::size_t i) {
+		// НОК знаменателей строки вместе с правой частью
+		BigInt rowMultiplier = 1;
+		for (std::size_t j = 0; j < width; ++j) {
+			const BigInt& denominator = (j < columnsCount ? elements[i * columnsCount + j] : rightSide[i * rightSideColumnsCount + j - columnsCount]).GetDenominator();
+			BigInt denominatorPart = denominator / BigInt::GetGreatestCommonDivisor(rowMultiplier, denominator);
+			rowMultiplier *= denominatorPart;
+		}
+		// домножение строки на НОК делает все элементы целыми
+		for (std::size_t j = 0; j < width; ++j) {
+			const BigIrreducibleFraction& element = (j < columnsCount ? elements[i * columnsCount + j] : rightSide[i * rightSideColumnsCount + j - columnsCount]);
+			matrix[i * width + j] = element.GetNumerator() * (rowMultiplier / element.GetDenominator());
+		}
+		rowMultipliers[i] = rowMultiplier;
+	}, parallelRowsChunkSize);
+	return matrix;
+}
+bool BigMatrix::EliminateBareiss(std::vector<BigInt>& matrix, const std::size_t& size, const std::size_t& width, int& swapsSign) {
+	BigInt previousPivot = 1;
+	for (std::size_t k = 0; k < size; ++k) {
+		// поиск ненулевого ведущего элемента в столбце k
+		std::size_t pivotRow = k;
+		while ((pivotRow < size) && (matrix[pivotRow * width + k] == 0))
+			++pivotRow;
+		if (pivotRow == size)
+			return false;
+		if (pivotRow != k) {
+			for (std::size_t j = k; j < width; ++j)
+				std::swap(matrix[pivotRow * width + j], matrix[k * width + j]);
+			swapsSign = -swapsSign;
+		}
+		// строки ниже ведущей обновляются независимо друг от друга, деление на предыдущий ведущий элемент всегда нацело
+		BigInt pivot = matrix[k * width + k];
+		ParallelFor(k + 1, size, [&](std::size_t i) {
+			BigInt rowFactor = matrix[i * width + k];
+			for (std::size_t j = k + 1; j < width; ++j)
+				matrix[i * width + j] = BigInt(Fuse(matrix[i * width + j]) * pivot - Fuse(rowFactor) * matrix[k * width + j]) / previousPivot;
+			matrix[i * width + k] = 0;
+		}, parallelRowsChunkSize);
+		previousPivot = pivot;
+	}
+	return true;
+}
+std::vector<BigInt> BigMatrix::SubstituteBackward(std::vector<BigInt>& matrix, const std::size_t& size, const std::size_t& width) {
+	std::size_t rightSideColumnsCount = width - size;
+	std::vector<BigInt> scaledSolution(size * rightSideColumnsCount);
+	if (size == 0)
+		return scaledSolution;
+	BigInt lastPivot = matrix[(size - 1) * width + size - 1];
+	// столбцы правой части решаются независимо, y[i] = (lastPivot * b[i] - sum(u[i][j] * y[j])) / u[i][i]
+	ParallelFor(0, rightSideColumnsCount, [&](std::size_t column) {
+		for (std::size_t i = size; i-- > 0;) {
+			BigInt sum = lastPivot * matrix[i * width + size + column];
+			for (std::size_t j = i + 1; j < size; ++j)
+				sum -= matrix[i * width + j] * scaledSolution[j * rightSideColumnsCount + column];
+			scaledSolution[i * rightSideColumnsCount + column] = sum / matrix[i * width + i];
+		}
+	});
+	return scaledSolution;
+}
@@ -0,0 +1,322 @@
+#include <ComputationCheckpoint.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ComputationCheckpoint::ComputationCheckpoint(const std::string& inPath) : path(inPath), checkpointsCount(0), isResumed(false), fileDescriptor(-1) {
+#if defined(__unix__) || defined(__APPLE__)
+	fileDescriptor = open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+	if (fileDescriptor < 0)
+		throw std::runtime_error("ComputationCheckpoint: cannot open " + path);
+	try {
+		struct stat fileStat;
+		if (fstat(fileDescriptor, &fileStat) != 0)
+			throw std::runtime_error("ComputationCheckpoint: cannot stat " + path);
+		std::size_t fileSize = fileStat.st_size, validSize = 0;
+		if (fileSize != 0) {
+			// записи применяются прямо из отображения, без копирования файла
+			void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (mapping == MAP_FAILED)
+				throw std::runtime_error("ComputationCheckpoint: cannot map " + path);
+			madvise(mapping, fileSize, MADV_SEQUENTIAL);
+			const char* data = static_cast<const char*>(mapping);
+			try {
+				validSize = Load(data, data + fileSize);
+			}
+			catch (...) {
+				munmap(mapping, fileSize);
+				throw;
+			}
+			munmap(mapping, fileSize);
+		}
+		// оборванная запись отрезается, чтобы следующие дописывались сразу за целыми
+		if ((validSize != fileSize) && (ftruncate(fileDescriptor, validSize) != 0))
+			throw std::runtime_error("ComputationCheckpoint: cannot truncate " + path);
+		if (validSize == 0)
+			Append(GetFileHeader());
+	}
+	catch (...) {
+		close(fileDescriptor);
+		throw;
+	}
+#else
+	std::vector<char> data;
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (file)
+			data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	std::size_t validSize = Load(data.data(), data.data() + data.size());
+	if ((validSize == 0) || (validSize != data.size())) {
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (validSize == 0)
+			file << GetFileHeader();
+		else
+			file.write(data.data(), validSize);
+		if (!file.flush())
+			throw std::runtime_error("ComputationCheckpoint: cannot write " + path);
+	}
+#endif
+	isResumed = (checkpointsCount != 0);
+}
+ComputationCheckpoint::~ComputationCheckpoint() {
+#if defined(__unix__) || defined(__APPLE__)
+	if (fileDescriptor >= 0)
+		close(fileDescriptor);
+#endif
+}
+bool ComputationCheckpoint::IsResumed() const {
+	return isResumed;
+}
+unsigned long long ComputationCheckpoint::GetCheckpointsCount() const {
+	return checkpointsCount;
+}
+void ComputationCheckpoint::SetNumber(const std::string& name, const BigInt& value) {
+	numbers[name] = value;
+	changedNumbers.insert(name);
+}
+void ComputationCheckpoint::SetFraction(const std::string& name, const BigIrreducibleFraction& value) {
+	fractions[name] = value;
+	changedFractions.insert(name);
+}
+void ComputationCheckpoint::SetIndex(const std::string& name, const unsigned long long& value) {
+	indices[name] = value;
+	changedIndices.insert(name);
+}
+bool ComputationCheckpoint::HasNumber(const std::string& name) const {
+	return numbers.count(name) != 0;
+}
+bool ComputationCheckpoint::HasFraction(const std::string& name) const {
+	return fractions.count(name) != 0;
+}
+bool ComputationCheckpoint::HasIndex(const std::string& name) const {
+	return indices.count(name) != 0;
+}
+const BigInt& ComputationCheckpoint::GetNumber(const std::string& name) const {
+	std::map<std::string, BigInt>::const_iterator it = numbers.find(name);
+	if (it == numbers.end())
+		throw std::out_of_range("ComputationCheckpoint: no number " + name);
+	return it->second;
+}
+const BigIrreducibleFraction& ComputationCheckpoint::GetFraction(const std::string& name) const {
+	std::map<std::string, BigIrreducibleFraction>::const_iterator it = fractions.find(name);
+	if (it == fractions.end())
+		throw std::out_of_range("ComputationCheckpoint: no fraction " + name);
+	return it->second;
+}
+unsigned long long ComputationCheckpoint::GetIndex(const std::string& name) const {
+	std::map<std::string, unsigned long long>::const_iterator it = indices.find(name);
+	if (it == indices.end())
+		throw std::out_of_range("ComputationCheckpoint: no index " + name);
+	return it->second;
+}
+void ComputationCheckpoint::Commit() {
+	if (changedNumbers.empty() && changedFractions.empty() && changedIndices.empty())
+		return;
+	Append(GetRecord(changedNumbers, changedFractions, changedIndices));
+	++checkpointsCount;
+	changedNumbers.clear();
+	changedFractions.clear();
+	changedIndices.clear();
+}
+void ComputationCheckpoint::Compact() {
+	std::set<std::string> numberNames, fractionNames, indexNames;
+	for (const std::pair<const std::string, BigInt>& value : numbers)
+		numberNames.insert(value.first);
+	for (const std::pair<const std::string, BigIrreducibleFraction>& value : fractions)
+		fractionNames.insert(value.first);
+	for (const std::pair<const std::string, unsigned long long>& value : indices)
+		indexNames.insert(value.first);
+	std::string data = GetFileHeader();
+	bool isEmpty = (numberNames.empty() && fractionNames.empty() && indexNames.empty());
+	if (!isEmpty)
+		data += GetRecord(numberNames, fractionNames, indexNames);
+	std::string temporaryPath = path + ".tmp";
+#if defined(__unix__) || defined(__APPLE__)
+	int temporaryDescriptor = open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (temporaryDescriptor < 0)
+		throw std::runtime_error("ComputationCheckpoint: cannot open " + temporaryPath);
+	std::size_t writtenSize = 0;
+	while (writtenSize < data.size()) {
+		ssize_t result = write(temporaryDescriptor, data.data() + writtenSize, data.size() - writtenSize);
+		if ((result < 0) && (errno == EINTR))
+			continue;
+		if (result <= 0)
+			break;
+		writtenSize += result;
+	}
+	// журнал заменяется только целым и сброшенным на диск файлом
+	if ((writtenSize != data.size()) || (fsync(temporaryDescriptor) != 0)) {
+		close(temporaryDescriptor);
+		unlink(temporaryPath.c_str());
+		throw std::runtime_error("ComputationCheckpoint: cannot write " + temporaryPath);
+	}
+	close(temporaryDescriptor);
+	if (rename(temporaryPath.c_str(), path.c_str()) != 0) {
+		unlink(temporaryPath.c_str());
+		throw std::runtime_error("ComputationCheckpoint: cannot replace " + path);
+	}
+	// старый дескриптор указывает на замененный файл
+	close(fileDescriptor);
+	fileDescriptor = open(path.c_str(), O_WRONLY | O_APPEND);
+	if (fileDescriptor < 0)
+		throw std::runtime_error("ComputationCheckpoint: cannot open " + path);
+#else
+	{
+		std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+		file << data;
+		if (!file.flush())
+			throw std::runtime_error("ComputationCheckpoint: cannot write " + temporaryPath);
+	}
+	// rename не заменяет существующий файл на всех платформах
+	std::remove(path.c_str());
+	if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+		throw std::runtime_error("ComputationCheckpoint: cannot replace " + path);
+#endif
+	checkpointsCount = (isEmpty ? 0 : 1);
+	changedNumbers.clear();
+	changedFractions.clear();
+	changedIndices.clear();
+}
+
+std::size_t ComputationCheckpoint::Load(const char* begin, const char* end) {
+	std::string header = GetFileHeader();
+	std::size_t size = end - begin;
+	// файл мог оборваться еще при записи заголовка
+	if (size < header.size()) {
+		if (std::memcmp(begin, header.data(), size) != 0)
+			throw std::runtime_error("ComputationCheckpoint: " + path + " is not a checkpoint journal");
+		return 0;
+	}
+	if (std::memcmp(begin, header.data(), header.size()) != 0)
+		throw std::runtime_error("ComputationCheckpoint: " + path + " is not a checkpoint journal");
+	const char* position = begin + header.size();
+	while ((std::size_t)(end - position) >= recordHeaderSize) {
+		std::size_t recordSize = ReadUnsigned(position);
+		const char* recordBegin = position + recordHeaderSize;
+		if (recordSize > (std::size_t)(end - recordBegin))
+			break;
+		if (GetChecksum(recordBegin, recordBegin + recordSize) != ReadUnsigned(position + 4))
+			break;
+		ApplyRecord(recordBegin, recordBegin + recordSize);
+		++checkpointsCount;
+		position = recordBegin + recordSize;
+	}
+	return position - begin;
+}
+void ComputationCheckpoint::ApplyRecord(const char* begin, const char* end) {
+	// запись с верной контрольной суммой применяется целиком: сначала читаются все значения
+	std::map<std::string, BigInt> recordNumbers;
+	std::map<std::string, BigIrreducibleFraction> recordFractions;
+	std::map<std::string, unsigned long long> recordIndices;
+	const char* position = begin;
+	unsigned long long valuesCount = BigIntSerialization::ReadVarint(position, end);
+	for (unsigned long long i = 0; i < valuesCount; ++i) {
+		if (position == end)
+			throw std::invalid_argument("ComputationCheckpoint: truncated record");
+		unsigned char kind = (unsigned char)*position++;
+		unsigned long long nameSize = BigIntSerialization::ReadVarint(position, end);
+		if (nameSize > (unsigned long long)(end - position))
+			throw std::invalid_argument("ComputationCheckpoint: truncated record");
+		std::string name(position, nameSize);
+		position += nameSize;
+		if (kind == (unsigned char)ValueKind::Number)
+			recordNumbers[name] = BigIntSerialization::ReadNumber(position, end);
+		else if (kind == (unsigned char)ValueKind::Fraction)
+			recordFractions[name] = BigIntSerialization::ReadFraction(position, end, true);
+		else if (kind == (unsigned char)ValueKind::Index)
+			recordIndices[name] = BigIntSerialization::ReadVarint(position, end);
+		else
+			throw std::invalid_argument("ComputationCheckpoint: unknown value kind " + std::to_string(kind));
+	}
+	if (position != end)
+		throw std::invalid_argument("ComputationCheckpoint: trailing bytes in record");
+	for (std::pair<const std::string, BigInt>& value : recordNumbers)
+		numbers[value.first] = std::move(value.second);
+	for (std::pair<const std::string, BigIrreducibleFraction>& value : recordFractions)
+		fractions[value.first] = std::move(value.second);
+	for (const std::pair<const std::string, unsigned long long>& value : recordIndices)
+		indices[value.first] = value.second;
+}
+std::string ComputationCheckpoint::GetRecord(const std::set<std::string>& numberNames, const std::set<std::string>& fractionNames, const std::set<std::string>& indexNames) const {
+	std::string record(recordHeaderSize, '\0');
+	BigIntSerialization::AppendVarint(record, numberNames.size() + fractionNames.size() + indexNames.size());
+	for (const std::string& name : numberNames) {
+		record.push_back((char)ValueKind::Number);
+		BigIntSerialization::AppendVarint(record, name.size());
+		record += name;
+		BigIntSerialization::AppendNumber(record, numbers.at(name));
+	}
+	for (const std::string& name : fractionNames) {
+		record.push_back((char)ValueKind::Fraction);
+		BigIntSerialization::AppendVarint(record, name.size());
+		record += name;
+		BigIntSerialization::AppendFraction(record, fractions.at(name));
+	}
+	for (const std::string& name : indexNames) {
+		record.push_back((char)ValueKind::Index);
+		BigIntSerialization::AppendVarint(record, name.size());
+		record += name;
+		BigIntSerialization::AppendVarint(record, indices.at(name));
+	}
+	if (record.size() - recordHeaderSize > 0xFFFFFFFFull)
+		throw std::length_error("ComputationCheckpoint: record is too large");
+	unsigned size = (unsigned)(record.size() - recordHeaderSize);
+	unsigned checksum = GetChecksum(record.data() + recordHeaderSize, record.data() + record.size());
+	for (std::size_t i = 0; i < 4; ++i) {
+		record[i] = (char)((size >> (8 * i)) & 0xFF);
+		record[4 + i] = (char)((checksum >> (8 * i)) & 0xFF);
+	}
+	return record;
+}
+void ComputationCheckpoint::Append(const std::string& data) {
+#if defined(__unix__) || defined(__APPLE__)
+	off_t previousSize = lseek(fileDescriptor, 0, SEEK_END);
+	std::size_t writtenSize = 0;
+	while (writtenSize < data.size()) {
+		ssize_t result = write(fileDescriptor, data.data() + writtenSize, data.size() - writtenSize);
+		if ((result < 0) && (errno == EINTR))
+			continue;
+		if (result <= 0)
+			break;
+		writtenSize += result;
+	}
+	if ((writtenSize != data.size()) || (fsync(fileDescriptor) != 0)) {
+		// недописанная запись убирается, иначе следующие записи окажутся за ней и не будут прочитаны
+		if (previousSize >= 0)
+			(void)ftruncate(fileDescriptor, previousSize);
+		throw std::runtime_error("ComputationCheckpoint: cannot write " + path);
+	}
+#else
+	std::ofstream file(path, std::ios::binary | std::ios::app);
+	file << data;
+	if (!file.flush())
+		throw std::runtime_error("ComputationCheckpoint: cannot write " + path);
+#endif
+}
+std::string ComputationCheckpoint::GetFileHeader() {
+	return std::string("BIFCHKPT\x01", 9);
+}
+unsigned ComputationCheckpoint::GetChecksum(const char* begin, const char* end) {
+	unsigned checksum = 2166136261u;
+	for (const char* position = begin; position != end; ++position) {
+		checksum ^= (unsigned char)*position;
+		checksum *= 16777619u;
+	}
+	return checksum;
+}
+unsigned ComputationCheckpoint::ReadUnsigned(const char* position) {
+	unsigned value = 0;
+	for (std::size_t i = 0; i < 4; ++i)
+		value |= (unsigned)(unsigned char)position[i] << (8 * i);
+	return value;
+}
@@ -0,0 +1,194 @@
+#include <ExpressionEvaluator.h>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+BigIrreducibleFraction ExpressionEvaluator::Evaluate(const std::string& expression, const ExpressionSyntax& syntax) {
+	return Evaluate(expression.data(), expression.data() + expression.size(), syntax);
+}
+BigIrreducibleFraction ExpressionEvaluator::Evaluate(const char* begin, const char* end, const ExpressionSyntax& syntax) {
+	if (syntax == ExpressionSyntax::ReversePolish)
+		return EvaluateReversePolish(begin, end);
+	const char* position = begin;
+	BigIrreducibleFraction result = ParseSum(begin, position, end, 0);
+	SkipSpaces(position, end);
+	if (position != end)
+		throw GetError(std::string("unexpected '") + *position + "'", begin, position);
+	return result;
+}
+
+BigIrreducibleFraction ExpressionEvaluator::ParseSum(const char* begin, const char*& position, const char* end, const unsigned& depth) {
+	BigIrreducibleFraction result = ParseProduct(begin, position, end, depth);
+	SkipSpaces(position, end);
+	while ((position != end) && ((*position == '+') || (*position == '-'))) {
+		char operation = *position++;
+		BigIrreducibleFraction operand = ParseProduct(begin, position, end, depth);
+		result = (operation == '+' ? result + operand : result - operand);
+		SkipSpaces(position, end);
+	}
+	return result;
+}
+BigIrreducibleFraction ExpressionEvaluator::ParseProduct(const char* begin, const char*& position, const char* end, const unsigned& depth) {
+	BigIrreducibleFraction result = ParseUnary(begin, position, end, depth);
+	SkipSpaces(position, end);
+	while ((position != end) && ((*position == '*') || (*position == '/'))) {
+		char operation = *position++;
+		BigIrreducibleFraction operand = ParseUnary(begin, position, end, depth);
+		result = (operation == '*' ? result * operand : GetQuotient(result, operand));
+		SkipSpaces(position, end);
+	}
+	return result;
+}
+BigIrreducibleFraction ExpressionEvaluator::ParseUnary(const char* begin, const char*& position, const char* end, const unsigned& depth) {
+	if (depth > maxDepth)
+		throw GetError("expression is nested too deeply", begin, position);
+	SkipSpaces(position, end);
+	if ((position != end) && (*position == '+')) {
+		++position;
+		return ParseUnary(begin, position, end, depth + 1);
+	}
+	if ((position != end) && (*position == '-')) {
+		++position;
+		return -ParseUnary(begin, position, end, depth + 1);
+	}
+	BigIrreducibleFraction base = ParsePrimary(begin, position, end, depth);
+	SkipSpaces(position, end);
+	if ((position == end) || (*position != '^'))
+		return base;
+	++position;
+	// показатель разбирается как унарное выражение, поэтому 2^-1 и 2^3^2 = 2^9 допустимы
+	return GetPower(base, ParseUnary(begin, position, end, depth + 1));
+}
+BigIrreducibleFraction ExpressionEvaluator::ParsePrimary(const char* begin, const char*& position, const char* end, const unsigned& depth) {
+	SkipSpaces(position, end);
+	if (position == end)
+		throw GetError("unexpected end of expression", begin, position);
+	if (*position == '(') {
+		++position;
+		BigIrreducibleFraction result = ParseSum(begin, position, end, depth + 1);
+		SkipSpaces(position, end);
+		if ((position == end) || (*position != ')'))
+			throw GetError("expected ')'", begin, position);
+		++position;
+		return result;
+	}
+	if (!std::isdigit((unsigned char)*position))
+		throw GetError(std::string("unexpected '") + *position + "'", begin, position);
+	const char* numberBegin = position;
+	while ((position != end) && std::isdigit((unsigned char)*position))
+		++position;
+	return BigIrreducibleFraction::CreateFromReduced(BigInt(numberBegin, position), 1);
+}
+BigIrreducibleFraction ExpressionEvaluator::EvaluateReversePolish(const char* begin, const char* end) {
+	std::vector<BigIrreducibleFraction> stack;
+	const char* position = begin;
+	SkipSpaces(position, end);
+	while (position != end) {
+		const char* tokenBegin = position;
+		while ((position != end) && !std::isspace((unsigned char)*position))
+			++position;
+		std::size_t tokenLength = position - tokenBegin;
+		if ((tokenLength == 1) && (std::strchr("+-*/^", *tokenBegin) != nullptr)) {
+			if (stack.size() < 2)
+				throw GetError(std::string("not enough operands for '") + *tokenBegin + "'", begin, tokenBegin);
+			BigIrreducibleFraction operand = stack.back();
+			stack.pop_back();
+			BigIrreducibleFraction& result = stack.back();
+			switch (*tokenBegin) {
+			case '+':
+				result += operand;
+				break;
+			case '-':
+				result -= operand;
+				break;
+			case '*':
+				result *= operand;
+				break;
+			case '/':
+				result = GetQuotient(result, operand);
+				break;
+			default:
+				result = GetPower(result, operand);
+				break;
+			}
+		}
+		else if ((tokenLength == 3) && (std::strncmp(tokenBegin, "neg", 3) == 0)) {
+			if (stack.empty())
+				throw GetError("not enough operands for 'neg'", begin, tokenBegin);
+			stack.back() = -stack.back();
+		}
+		else {
+			// число: [-]цифры или [-]цифры/цифры
+			const char* slash = std::find(tokenBegin, position, '/');
+			const char* digitsBegin = tokenBegin + (*tokenBegin == '-' ? 1 : 0);
+			bool isValid = (digitsBegin != slash) && ((slash == position) || (slash + 1 != position));
+			for (const char* symbol = digitsBegin; symbol != position; ++symbol)
+				if ((symbol != slash) && !std::isdigit((unsigned char)*symbol))
+					isValid = false;
+			if (!isValid)
+				throw GetError("unexpected token '" + std::string(tokenBegin, position) + "'", begin, tokenBegin);
+			BigInt numerator(tokenBegin, slash);
+			if (slash == position)
+				stack.push_back(BigIrreducibleFraction::CreateFromReduced(numerator, 1));
+			else {
+				BigInt denominator(slash + 1, position);
+				if (denominator == 0)
+					throw std::domain_error("ExpressionEvaluator: division by zero");
+				stack.push_back(BigIrreducibleFraction(numerator, denominator));
+			}
+		}
+		SkipSpaces(position, end);
+	}
+	if (stack.size() != 1)
+		throw GetError("expected one value on the stack, got " + std::to_string(stack.size()), begin, position);
+	return stack.back();
+}
+BigIrreducibleFraction ExpressionEvaluator::GetQuotient(const BigIrreducibleFraction& dividend, const BigIrreducibleFraction& divisor) {
+	if (divisor.GetNumerator() == 0)
+		throw std::domain_error("ExpressionEvaluator: division by zero");
+	return dividend / divisor;
+}
+BigIrreducibleFraction ExpressionEvaluator::GetPower(const BigIrreducibleFraction& base, const BigIrreducibleFraction& exponent) {
+	if (exponent.GetDenominator() != 1)
+		throw std::invalid_argument("ExpressionEvaluator: exponent must be an integer");
+	const BigInt& signedExponent = exponent.GetNumerator();
+	std::ostringstream stream;
+	stream << (signedExponent < 0 ? -signedExponent : signedExponent);
+	if (stream.str().length() > 18)
+		throw std::invalid_argument("ExpressionEvaluator: exponent is too large");
+	unsigned long long absoluteExponent = std::strtoull(stream.str().c_str(), nullptr, 10);
+	// длина результата - показатель, умноженный на логарифм большей из частей основания; у 0, 1 и -1 степень не растет
+	bool isGrowing = (base.GetDenominator() != 1) || ((base.GetNumerator() != 0) && (base.GetNumerator() != 1) && (base.GetNumerator() != -1));
+	if (isGrowing && (absoluteExponent * std::max(GetLogarithm(base.GetNumerator()), GetLogarithm(base.GetDenominator())) > maxResultDigitsCount))
+		throw std::invalid_argument("ExpressionEvaluator: result of power is too large");
+	// степени взаимно простых чисел взаимно просты, поэтому результат не нужно сокращать
+	BigInt numerator = BigInt::GetPower(base.GetNumerator(), absoluteExponent);
+	BigInt denominator = BigInt::GetPower(base.GetDenominator(), absoluteExponent);
+	if (signedExponent >= 0)
+		return BigIrreducibleFraction::CreateFromReduced(numerator, denominator);
+	if (numerator == 0)
+		throw std::domain_error("ExpressionEvaluator: zero to a negative power");
+	if (numerator < 0)
+		return BigIrreducibleFraction::CreateFromReduced(-denominator, -numerator);
+	return BigIrreducibleFraction::CreateFromReduced(denominator, numerator);
+}
+double ExpressionEvaluator::GetLogarithm(const BigInt& num) {
+	if (num == 0)
+		return 0;
+	std::ostringstream stream;
+	stream << (num < 0 ? -num : num);
+	std::string digits = stream.str();
+	std::size_t leadingDigitsCount = std::min<std::size_t>(digits.size(), 15);
+	return std::log10(std::strtod(digits.substr(0, leadingDigitsCount).c_str(), nullptr)) + (digits.size() - leadingDigitsCount);
+}
+void ExpressionEvaluator::SkipSpaces(const char*& position, const char* end) {
+	while ((position != end) && std::isspace((unsigned char)*position))
+		++position;
+}
+std::invalid_argument ExpressionEvaluator::GetError(const std::string& message, const char* begin, const char* position) {
+	return std::invalid_argument("ExpressionEvaluator: " + message + " at position " + std::to_string(position - begin + 1));
+}
@@ -0,0 +1,4 @@
+#include <FixedBigInt.h>
+
+FixedBigIntOverflowException::FixedBigIntOverflowException(const std::string& reason) : std::overflow_error(reason) {
+}
@@ -0,0 +1,167 @@
+#include <FractionClient.h>
+#include <cerrno>
+#include <cstring>
+#include <unordered_map>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+int FractionSocket::Connect(const std::string& path) {
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	if (path.size() >= sizeof(address.sun_path))
+		throw std::runtime_error("FractionSocket: socket path is too long: " + path);
+	address.sun_family = AF_UNIX;
+	std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+	int socketDescriptor = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (socketDescriptor < 0)
+		throw std::runtime_error("FractionSocket: cannot create socket");
+	if (::connect(socketDescriptor, (const sockaddr*)&address, sizeof(address)) != 0) {
+		::close(socketDescriptor);
+		throw std::runtime_error("FractionSocket: cannot connect to " + path + ": " + std::strerror(errno));
+	}
+	return socketDescriptor;
+}
+void FractionSocket::Close(const int& socket) {
+	::close(socket);
+}
+bool FractionSocket::ReadFrame(const int& socket, std::string& payload) {
+	// чтение ровно size байт, false - соединение закрыто до первого байта кадра
+	auto readExactly = [&socket](char* buffer, const std::size_t& size, const bool& isFrameStart) {
+		std::size_t readCount = 0;
+		while (readCount < size) {
+			ssize_t result = ::recv(socket, buffer + readCount, size - readCount, 0);
+			if ((result < 0) && (errno == EINTR))
+				continue;
+			if (result <= 0) {
+				if ((result == 0) && isFrameStart && (readCount == 0))
+					return false;
+				throw std::runtime_error("FractionSocket: connection closed in the middle of a frame");
+			}
+			readCount += result;
+		}
+		return true;
+	};
+	unsigned char header[4];
+	if (!readExactly((char*)header, sizeof(header), true))
+		return false;
+	std::size_t size = FractionProtocol::GetFrameSize(header);
+	if (size > FractionProtocol::maxFrameSize)
+		throw std::runtime_error("FractionSocket: frame is too large");
+	payload.resize(size);
+	if (size != 0)
+		readExactly(&payload[0], size, false);
+	return true;
+}
+bool FractionSocket::WriteFrame(const int& socket, const std::string& frame) {
+	std::size_t writtenCount = 0;
+	while (writtenCount < frame.size()) {
+#ifdef MSG_NOSIGNAL
+		ssize_t result = ::send(socket, frame.data() + writtenCount, frame.size() - writtenCount, MSG_NOSIGNAL);
+#else
+		ssize_t result = ::send(socket, frame.data() + writtenCount, frame.size() - writtenCount, 0);
+#endif
+		if ((result < 0) && (errno == EINTR))
+			continue;
+		if (result <= 0)
+			return false;
+		writtenCount += result;
+	}
+	return true;
+}
+#else
+int FractionSocket::Connect(const std::string& path) {
+	throw std::runtime_error("FractionSocket: local sockets are not supported on this platform");
+}
+void FractionSocket::Close(const int& socket) {
+}
+bool FractionSocket::ReadFrame(const int& socket, std::string& payload) {
+	throw std::runtime_error("FractionSocket: local sockets are not supported on this platform");
+}
+bool FractionSocket::WriteFrame(const int& socket, const std::string& frame) {
+	throw std::runtime_error("FractionSocket: local sockets are not supported on this platform");
+}
+#endif
+
+FractionClient::FractionClient(const std::string& socketPath) {
+	socket = FractionSocket::Connect(socketPath);
+	nextId = 0;
+}
+FractionClient::~FractionClient() {
+	FractionSocket::Close(socket);
+}
+std::vector<FractionResponse> FractionClient::Execute(const std::vector<FractionRequest>& requests) {
+	std::lock_guard<std::mutex> lock(clientMutex);
+	// id запросов заменяются своими, чтобы ответы однозначно сопоставлялись с позициями в пакете
+	std::vector<FractionRequest> numberedRequests = requests;
+	std::unordered_map<unsigned long long, std::size_t> positions;
+	for (std::size_t i = 0; i < numberedRequests.size(); ++i) {
+		numberedRequests[i].id = nextId++;
+		positions[numberedRequests[i].id] = i;
+	}
+	std::string frame;
+	FractionProtocol::AppendRequests(frame, numberedRequests);
+	if (!FractionSocket::WriteFrame(socket, frame))
+		throw std::runtime_error("FractionClient: connection to the server is lost");
+	std::vector<FractionResponse> responses(requests.size());
+	std::size_t receivedCount = 0;
+	std::string payload;
+	while (receivedCount < requests.size()) {
+		if (!FractionSocket::ReadFrame(socket, payload))
+			throw std::runtime_error("FractionClient: connection to the server is lost");
+		for (FractionResponse& response : FractionProtocol::ParseResponses(payload.data(), payload.data() + payload.size())) {
+			std::unordered_map<unsigned long long, std::size_t>::iterator position = positions.find(response.id);
+			if (position == positions.end())
+				throw std::runtime_error("FractionClient: unexpected response id " + std::to_string(response.id));
+			response.id = requests[position->second].id;
+			responses[position->second] = std::move(response);
+			positions.erase(position);
+			++receivedCount;
+		}
+	}
+	return responses;
+}
+BigInt FractionClient::Calculate(const FractionServiceOperation& operation, const BigInt& num1, const BigInt& num2, const unsigned& deadlineMilliseconds) {
+	FractionResponse response = ExecuteOne(operation, { num1, num2 }, deadlineMilliseconds);
+	if (response.results.size() != 1)
+		throw std::runtime_error("FractionClient: operation result is not a number");
+	return response.results[0];
+}
+BigIrreducibleFraction FractionClient::Calculate(const FractionServiceOperation& operation, const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2,
+	const unsigned& deadlineMilliseconds) {
+	FractionResponse response = ExecuteOne(operation, { num1.GetNumerator(), num1.GetDenominator(), num2.GetNumerator(), num2.GetDenominator() }, deadlineMilliseconds);
+	if (response.results.size() != 2)
+		throw std::runtime_error("FractionClient: operation result is not a fraction");
+	return BigIrreducibleFraction::CreateFromReduced(response.results[0], response.results[1]);
+}
+int FractionClient::Compare(const BigIrreducibleFraction& num1, const BigIrreducibleFraction& num2, const unsigned& deadlineMilliseconds) {
+	FractionResponse response = ExecuteOne(FractionServiceOperation::FractionCompare,
+		{ num1.GetNumerator(), num1.GetDenominator(), num2.GetNumerator(), num2.GetDenominator() }, deadlineMilliseconds);
+	if (response.results.size() != 1)
+		throw std::runtime_error("FractionClient: comparison result is not a number");
+	return (response.results[0] < 0 ? -1 : (response.results[0] == 0 ? 0 : 1));
+}
+void FractionClient::ThrowIfFailed(const FractionResponse& response) {
+	switch (response.status) {
+	case FractionServiceStatus::Ok:
+		return;
+	case FractionServiceStatus::InvalidArgument:
+		throw std::invalid_argument(response.message);
+	case FractionServiceStatus::DomainError:
+		throw std::domain_error(response.message);
+	case FractionServiceStatus::DeadlineExceeded:
+		throw OperationCancelledException(response.message);
+	default:
+		throw std::runtime_error(response.message);
+	}
+}
+FractionResponse FractionClient::ExecuteOne(const FractionServiceOperation& operation, const std::vector<BigInt>& operands, const unsigned& deadlineMilliseconds) {
+	if (operands.size() != FractionProtocol::GetOperandsCount(operation))
+		throw std::invalid_argument("FractionClient: wrong operands count for the operation");
+	std::vector<FractionResponse> responses = Execute({ FractionRequest{ 0, operation, deadlineMilliseconds, operands } });
+	ThrowIfFailed(responses[0]);
+	return responses[0];
+}
@@ -0,0 +1,226 @@
+#include <FractionProtocol.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+std::atomic<unsigned long long> FractionProtocol::maxResultDigitsCount(1000000);
+
+std::size_t FractionProtocol::GetOperandsCount(const FractionServiceOperation& operation) {
+	switch (operation) {
+	case FractionServiceOperation::FractionSum:
+	case FractionServiceOperation::FractionDifference:
+	case FractionServiceOperation::FractionProduct:
+	case FractionServiceOperation::FractionQuotient:
+	case FractionServiceOperation::FractionCompare:
+		return 4;
+	default:
+		return 2;
+	}
+}
+void FractionProtocol::AppendRequests(std::string& frame, const std::vector<FractionRequest>& requests) {
+	std::size_t headerPosition;
+	BeginFrame(frame, headerPosition);
+	BigIntSerialization::AppendVarint(frame, requests.size());
+	for (const FractionRequest& request : requests) {
+		BigIntSerialization::AppendVarint(frame, request.id);
+		frame.push_back((char)request.operation);
+		BigIntSerialization::AppendVarint(frame, request.deadlineMilliseconds);
+		for (const BigInt& operand : request.operands)
+			BigIntSerialization::AppendNumber(frame, operand);
+	}
+	EndFrame(frame, headerPosition);
+}
+void FractionProtocol::AppendResponses(std::string& frame, const std::vector<FractionResponse>& responses) {
+	std::size_t headerPosition;
+	BeginFrame(frame, headerPosition);
+	BigIntSerialization::AppendVarint(frame, responses.size());
+	for (const FractionResponse& response : responses) {
+		BigIntSerialization::AppendVarint(frame, response.id);
+		frame.push_back((char)response.status);
+		if (response.status == FractionServiceStatus::Ok) {
+			BigIntSerialization::AppendVarint(frame, response.results.size());
+			for (const BigInt& result : response.results)
+				BigIntSerialization::AppendNumber(frame, result);
+		}
+		else {
+			BigIntSerialization::AppendVarint(frame, response.message.size());
+			frame += response.message;
+		}
+	}
+	EndFrame(frame, headerPosition);
+}
+std::vector<FractionRequest> FractionProtocol::ParseRequests(const char* begin, const char* end) {
+	const char* position = begin;
+	unsigned long long requestsCount = BigIntSerialization::ReadVarint(position, end);
+	// каждый запрос занимает хотя бы 3 байта, поэтому заведомо ложное количество не приводит к огромному резерву
+	if (requestsCount > (unsigned long long)(end - position) / 3)
+		throw std::invalid_argument("FractionProtocol: invalid requests count");
+	std::vector<FractionRequest> requests(requestsCount);
+	for (FractionRequest& request : requests) {
+		request.id = BigIntSerialization::ReadVarint(position, end);
+		if (position == end)
+			throw std::invalid_argument("FractionProtocol: truncated request");
+		unsigned char operation = (unsigned char)*position++;
+		if (operation >= operationsCount)
+			throw std::invalid_argument("FractionProtocol: unknown operation " + std::to_string(operation));
+		request.operation = (FractionServiceOperation)operation;
+		request.deadlineMilliseconds = (unsigned)BigIntSerialization::ReadVarint(position, end);
+		request.operands.resize(GetOperandsCount(request.operation));
+		for (BigInt& operand : request.operands)
+			operand = BigIntSerialization::ReadNumber(position, end);
+	}
+	if (position != end)
+		throw std::invalid_argument("FractionProtocol: trailing bytes after requests");
+	return requests;
+}
+std::vector<FractionResponse> FractionProtocol::ParseResponses(const char* begin, const char* end) {
+	const char* position = begin;
+	unsigned long long responsesCount = BigIntSerialization::ReadVarint(position, end);
+	if (responsesCount > (unsigned long long)(end - position) / 3)
+		throw std::invalid_argument("FractionProtocol: invalid responses count");
+	std::vector<FractionResponse> responses(responsesCount);
+	for (FractionResponse& response : responses) {
+		response.id = BigIntSerialization::ReadVarint(position, end);
+		if (position == end)
+			throw std::invalid_argument("FractionProtocol: truncated response");
+		unsigned char status = (unsigned char)*position++;
+		if (status > (unsigned char)FractionServiceStatus::InternalError)
+			throw std::invalid_argument("FractionProtocol: unknown status " + std::to_string(status));
+		response.status = (FractionServiceStatus)status;
+		unsigned long long count = BigIntSerialization::ReadVarint(position, end);
+		if (count > (unsigned long long)(end - position))
+			throw std::invalid_argument("FractionProtocol: truncated response");
+		if (response.status == FractionServiceStatus::Ok) {
+			response.results.resize(count);
+			for (BigInt& result : response.results)
+				result = BigIntSerialization::ReadNumber(position, end);
+		}
+		else {
+			response.message.assign(position, count);
+			position += count;
+		}
+	}
+	if (position != end)
+		throw std::invalid_argument("FractionProtocol: trailing bytes after responses");
+	return responses;
+}
+std::size_t FractionProtocol::GetFrameSize(const unsigned char* header) {
+	std::size_t size = 0;
+	for (std::size_t i = 0; i < frameHeaderSize; ++i)
+		size |= (std::size_t)header[i] << (8 * i);
+	return size;
+}
+FractionResponse FractionProtocol::Execute(const FractionRequest& request) {
+	FractionResponse response = { request.id, FractionServiceStatus::Ok, std::vector<BigInt>(), std::string() };
+	try {
+		response.results = GetResults(request);
+	}
+	catch (const OperationCancelledException& exception) {
+		response.status = FractionServiceStatus::DeadlineExceeded;
+		response.message = exception.what();
+	}
+	catch (const std::invalid_argument& exception) {
+		response.status = FractionServiceStatus::InvalidArgument;
+		response.message = exception.what();
+	}
+	catch (const std::domain_error& exception) {
+		response.status = FractionServiceStatus::DomainError;
+		response.message = exception.what();
+	}
+	catch (const std::exception& exception) {
+		response.status = FractionServiceStatus::InternalError;
+		response.message = exception.what();
+	}
+	return response;
+}
+void FractionProtocol::SetMaxResultDigitsCount(const unsigned long long& digitsCount) {
+	maxResultDigitsCount = digitsCount;
+}
+unsigned long long FractionProtocol::GetMaxResultDigitsCount() {
+	return maxResultDigitsCount;
+}
+
+void FractionProtocol::BeginFrame(std::string& frame, std::size_t& headerPosition) {
+	headerPosition = frame.size();
+	frame.append(frameHeaderSize, '\0');
+}
+void FractionProtocol::EndFrame(std::string& frame, const std::size_t& headerPosition) {
+	std::size_t size = frame.size() - headerPosition - frameHeaderSize;
+	if (size > maxFrameSize)
+		throw std::length_error("FractionProtocol: frame is too large");
+	for (std::size_t i = 0; i < frameHeaderSize; ++i)
+		frame[headerPosition + i] = (char)((size >> (8 * i)) & 0xFF);
+}
+BigIrreducibleFraction FractionProtocol::GetFraction(const BigInt& numerator, const BigInt& denominator) {
+	// операции над дробями верны и для несократимых операндов (результат сокращается), поэтому НОД операндов не считается
+	if (denominator == 0)
+		throw std::invalid_argument("FractionProtocol: zero denominator");
+	if (denominator < 0)
+		return BigIrreducibleFraction::CreateFromReduced(-numerator, -denominator);
+	return BigIrreducibleFraction::CreateFromReduced(numerator, denominator);
+}
+std::vector<BigInt> FractionProtocol::GetResults(const FractionRequest& request) {
+	const std::vector<BigInt>& operands = request.operands;
+	if (operands.size() != GetOperandsCount(request.operation))
+		throw std::invalid_argument("FractionProtocol: wrong operands count");
+	switch (request.operation) {
+	case FractionServiceOperation::Sum:
+		return { operands[0] + operands[1] };
+	case FractionServiceOperation::Difference:
+		return { operands[0] - operands[1] };
+	case FractionServiceOperation::Product:
+		return { operands[0] * operands[1] };
+	case FractionServiceOperation::Quotient:
+	case FractionServiceOperation::Remainder:
+		if (operands[1] == 0)
+			throw std::domain_error("FractionProtocol: division by zero");
+		return { (request.operation == FractionServiceOperation::Quotient ? operands[0] / operands[1] : operands[0] % operands[1]) };
+	case FractionServiceOperation::GreatestCommonDivisor:
+		return { BigInt::GetGreatestCommonDivisor(operands[0], operands[1]) };
+	case FractionServiceOperation::Power: {
+		std::ostringstream stream;
+		stream << operands[1];
+		if ((operands[1] < 0) || (stream.str().length() > 18))
+			throw std::invalid_argument("FractionProtocol: exponent must be non-negative and less than 10^18");
+		unsigned long long exponent = std::strtoull(stream.str().c_str(), nullptr, 10);
+		// у 0, 1 и -1 степень не растет, у остальных длина результата - показатель, умноженный на логарифм основания
+		if ((operands[0] != 0) && (operands[0] != 1) && (operands[0] != -1)) {
+			std::ostringstream baseStream;
+			baseStream << (operands[0] < 0 ? -operands[0] : operands[0]);
+			std::string digits = baseStream.str();
+			std::size_t leadingDigitsCount = std::min<std::size_t>(digits.size(), 15);
+			double logarithm = std::log10(std::strtod(digits.substr(0, leadingDigitsCount).c_str(), nullptr)) + (digits.size() - leadingDigitsCount);
+			if (exponent * logarithm > maxResultDigitsCount.load())
+				throw std::invalid_argument("FractionProtocol: result of power is longer than " + std::to_string(maxResultDigitsCount.load()) + " digits");
+		}
+		return { BigInt::GetPower(operands[0], exponent) };
+	}
+	case FractionServiceOperation::FractionReduction: {
+		if (operands[1] == 0)
+			throw std::domain_error("FractionProtocol: division by zero");
+		BigIrreducibleFraction result(operands[0], operands[1]);
+		return { result.GetNumerator(), result.GetDenominator() };
+	}
+	case FractionServiceOperation::FractionCompare: {
+		BigIrreducibleFraction num1 = GetFraction(operands[0], operands[1]), num2 = GetFraction(operands[2], operands[3]);
+		return { BigInt(num1 < num2 ? -1 : (num2 < num1 ? 1 : 0)) };
+	}
+	default: {
+		BigIrreducibleFraction num1 = GetFraction(operands[0], operands[1]), num2 = GetFraction(operands[2], operands[3]);
+		BigIrreducibleFraction result;
+		if (request.operation == FractionServiceOperation::FractionSum)
+			result = num1 + num2;
+		else if (request.operation == FractionServiceOperation::FractionDifference)
+			result = num1 - num2;
+		else if (request.operation == FractionServiceOperation::FractionProduct)
+			result = num1 * num2;
+		else {
+			if (num2.GetNumerator() == 0)
+				throw std::domain_error("FractionProtocol: division by zero");
+			result = num1 / num2;
+		}
+		return { result.GetNumerator(), result.GetDenominator() };
+	}
+	}
+}
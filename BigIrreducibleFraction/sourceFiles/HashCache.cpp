@@ -0,0 +1,37 @@
+#include <HashCache.h>
+
+#ifndef BIG_INT_DISABLE_HASH_CACHE
+HashCache::HashCache() : cachedHash(0) {
+}
+HashCache::HashCache(const HashCache& other) : cachedHash(other.cachedHash.load(std::memory_order_relaxed)) {
+}
+HashCache& HashCache::operator=(const HashCache& other) {
+	cachedHash.store(other.cachedHash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	return *this;
+}
+bool HashCache::TryGet(std::size_t& hash) const {
+	hash = cachedHash.load(std::memory_order_relaxed);
+	return hash != 0;
+}
+void HashCache::Set(const std::size_t& hash) const {
+	cachedHash.store(hash, std::memory_order_relaxed);
+}
+void HashCache::Reset() {
+	cachedHash.store(0, std::memory_order_relaxed);
+}
+#else
+HashCache::HashCache() {
+}
+HashCache::HashCache(const HashCache&) {
+}
+HashCache& HashCache::operator=(const HashCache&) {
+	return *this;
+}
+bool HashCache::TryGet(std::size_t&) const {
+	return false;
+}
+void HashCache::Set(const std::size_t&) const {
+}
+void HashCache::Reset() {
+}
+#endif
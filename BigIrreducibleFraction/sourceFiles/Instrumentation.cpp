@@ -0,0 +1,108 @@
+#include <Instrumentation.h>
+#include <mutex>
+
+const KernelCounters& InstrumentationSnapshot::Get(const InstrumentedKernel& kernel) const {
+	return kernels[(std::size_t)kernel];
+}
+
+struct InstrumentationInbox {
+	std::mutex mutex;
+	InstrumentationSnapshot counters = {};
+};
+
+thread_local InstrumentationSnapshot Instrumentation::counters = {};
+thread_local std::shared_ptr<InstrumentationInbox> Instrumentation::inbox;
+thread_local InstrumentedKernel Instrumentation::currentKernel = InstrumentedKernel::Other;
+
+namespace {
+	void AddCounters(InstrumentationSnapshot& result, const InstrumentationSnapshot& counters) {
+		for (std::size_t i = 0; i < InstrumentationSnapshot::kernelsCount; ++i) {
+			result.kernels[i].callsCount += counters.kernels[i].callsCount;
+			result.kernels[i].digitsCount += counters.kernels[i].digitsCount;
+			result.kernels[i].iterationsCount += counters.kernels[i].iterationsCount;
+			result.kernels[i].allocationsCount += counters.kernels[i].allocationsCount;
+			result.kernels[i].allocatedBytes += counters.kernels[i].allocatedBytes;
+		}
+	}
+}
+
+bool Instrumentation::IsEnabled() {
+#ifdef BIGINT_INSTRUMENTATION
+	return true;
+#else
+	return false;
+#endif
+}
+InstrumentationSnapshot Instrumentation::GetSnapshot() {
+	InstrumentationSnapshot snapshot = counters;
+	if (inbox) {
+		std::lock_guard<std::mutex> lock(inbox->mutex);
+		AddCounters(snapshot, inbox->counters);
+	}
+	return snapshot;
+}
+void Instrumentation::Reset() {
+	counters = InstrumentationSnapshot();
+	if (inbox) {
+		std::lock_guard<std::mutex> lock(inbox->mutex);
+		inbox->counters = InstrumentationSnapshot();
+	}
+}
+const char* Instrumentation::GetKernelName(const InstrumentedKernel& kernel) {
+	static const char* const names[InstrumentationSnapshot::kernelsCount] = {
+		"sum", "difference", "product", "quotient", "greatest_common_divisor", "power", "root", "fraction_reduction", "other"
+	};
+	return names[(std::size_t)kernel];
+}
+void Instrumentation::AddCall(const InstrumentedKernel& kernel, const std::size_t& digitsCount) {
+	KernelCounters& kernelCounters = counters.kernels[(std::size_t)kernel];
+	++kernelCounters.callsCount;
+	kernelCounters.digitsCount += digitsCount;
+}
+void Instrumentation::AddIteration(const InstrumentedKernel& kernel) {
+	++counters.kernels[(std::size_t)kernel].iterationsCount;
+}
+void Instrumentation::AddAllocation(const std::size_t& bytes) {
+	KernelCounters& kernelCounters = counters.kernels[(std::size_t)currentKernel];
+	++kernelCounters.allocationsCount;
+	kernelCounters.allocatedBytes += bytes;
+}
+InstrumentationTaskState Instrumentation::GetTaskState() {
+	InstrumentationTaskState state = { nullptr, currentKernel };
+#ifdef BIGINT_INSTRUMENTATION
+	if (!inbox)
+		inbox = std::make_shared<InstrumentationInbox>();
+	state.inbox = inbox;
+#endif
+	return state;
+}
+
+InstrumentationScope::InstrumentationScope(const InstrumentedKernel& kernel, const std::size_t& digitsCount) {
+	previousKernel = Instrumentation::currentKernel;
+	Instrumentation::currentKernel = kernel;
+	Instrumentation::AddCall(kernel, digitsCount);
+}
+InstrumentationScope::~InstrumentationScope() {
+	Instrumentation::currentKernel = previousKernel;
+}
+
+InstrumentationTaskScope::InstrumentationTaskScope(const InstrumentationTaskState& state) : inbox(state.inbox) {
+	previousKernel = Instrumentation::currentKernel;
+	if (!inbox)
+		return;
+	// счетчики задачи копятся с нуля и уходят добавившему ее потоку, а счетчики выполняющего потока потом возвращаются,
+	// поэтому задачи, перехваченные внутри другой задачи, не попадают в счетчики обеих
+	previousCounters = Instrumentation::counters;
+	Instrumentation::counters = InstrumentationSnapshot();
+	Instrumentation::currentKernel = state.kernel;
+}
+InstrumentationTaskScope::~InstrumentationTaskScope() {
+	if (!inbox)
+		return;
+	{
+		std::lock_guard<std::mutex> lock(inbox->mutex);
+		AddCounters(inbox->counters, Instrumentation::counters);
+	}
+	Instrumentation::counters = previousCounters;
+	Instrumentation::currentKernel = previousKernel;
+}
@@ -0,0 +1,35 @@
+#include <Instrumentation.h>
+#include <cstdlib>
+#include <new>
+
+// замена глобального выделения памяти: то же malloc, но с подсчетом в Instrumentation
+// не входит в библиотеку, чтобы она не забирала выделения памяти всего процесса; компонуется в программы со счетчиками
+
+void* operator new(std::size_t size) {
+	Instrumentation::AddAllocation(size);
+	if (void* pointer = std::malloc(size == 0 ? 1 : size))
+		return pointer;
+	throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+	return operator new(size);
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	Instrumentation::AddAllocation(size);
+	return std::malloc(size == 0 ? 1 : size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+	return operator new(size, tag);
+}
+void operator delete(void* pointer) noexcept {
+	std::free(pointer);
+}
+void operator delete[](void* pointer) noexcept {
+	std::free(pointer);
+}
+void operator delete(void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+void operator delete[](void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
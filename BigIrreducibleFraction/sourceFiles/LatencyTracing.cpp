@@ -0,0 +1,128 @@
+#include <LatencyTracing.h>
+
+void LatencyHistogram::Add(const unsigned long long& nanoseconds) {
+	++counts[GetBucket(nanoseconds)];
+}
+unsigned long long LatencyHistogram::GetTotalCount() const {
+	unsigned long long totalCount = 0;
+	for (std::size_t i = 0; i < bucketsCount; ++i)
+		totalCount += counts[i];
+	return totalCount;
+}
+unsigned long long LatencyHistogram::GetQuantileUpperBound(const double& quantile) const {
+	unsigned long long totalCount = GetTotalCount(), count = 0;
+	for (std::size_t i = 0; i < bucketsCount; ++i) {
+		count += counts[i];
+		if ((totalCount != 0) && (count >= quantile * totalCount))
+			return (i == 0 ? 0 : (1ULL << i) - 1);
+	}
+	return 0;
+}
+std::size_t LatencyHistogram::GetBucket(const unsigned long long& nanoseconds) {
+	std::size_t bucket = 0;
+	while ((bucket + 1 < bucketsCount) && ((nanoseconds >> bucket) != 0))
+		++bucket;
+	return bucket;
+}
+
+std::atomic<bool> LatencyTracing::isHistogramsEnabled(false);
+std::atomic<bool> LatencyTracing::isTracingEnabled(false);
+std::shared_ptr<const std::function<void(const TraceEvent&)>> LatencyTracing::traceCallback;
+std::atomic<unsigned long long> LatencyTracing::histograms[LatencyTracing::operationsCount][LatencyTracing::sizeClassesCount][LatencyHistogram::bucketsCount];
+
+void LatencyTracing::SetHistogramsEnabled(const bool& isEnabled) {
+	isHistogramsEnabled.store(isEnabled, std::memory_order_relaxed);
+}
+void LatencyTracing::SetTraceCallback(const std::function<void(const TraceEvent&)>& callback) {
+	// обработчик заменяется атомарно, операции в других потоках видят либо старый, либо новый
+	std::shared_ptr<const std::function<void(const TraceEvent&)>> newCallback;
+	if (callback)
+		newCallback = std::make_shared<const std::function<void(const TraceEvent&)>>(callback);
+	std::atomic_store(&traceCallback, newCallback);
+	isTracingEnabled.store(static_cast<bool>(callback), std::memory_order_relaxed);
+}
+bool LatencyTracing::IsActive() {
+	return isHistogramsEnabled.load(std::memory_order_relaxed) || isTracingEnabled.load(std::memory_order_relaxed);
+}
+LatencyHistogram LatencyTracing::GetHistogram(const TracedOperation& operation, const std::size_t& sizeClass) {
+	if (sizeClass >= sizeClassesCount)
+		throw std::out_of_range("LatencyTracing: size class out of range");
+	LatencyHistogram histogram;
+	for (std::size_t i = 0; i < LatencyHistogram::bucketsCount; ++i)
+		histogram.counts[i] = histograms[(std::size_t)operation][sizeClass][i].load(std::memory_order_relaxed);
+	return histogram;
+}
+void LatencyTracing::ResetHistograms() {
+	for (std::size_t operation = 0; operation < operationsCount; ++operation)
+		for (std::size_t sizeClass = 0; sizeClass < sizeClassesCount; ++sizeClass)
+			for (std::size_t i = 0; i < LatencyHistogram::bucketsCount; ++i)
+				histograms[operation][sizeClass][i].store(0, std::memory_order_relaxed);
+}
+std::size_t LatencyTracing::GetSizeClass(const std::size_t& digitsCount) {
+	std::size_t sizeClass = 0;
+	while ((digitsCount >> (sizeClass + 1)) != 0)
+		++sizeClass;
+	return (sizeClass < sizeClassesCount ? sizeClass : sizeClassesCount - 1);
+}
+const char* LatencyTracing::GetOperationName(const TracedOperation& operation) {
+	static const char* const names[operationsCount] = { "multiplication", "division", "greatest_common_divisor", "fraction_reduction" };
+	return names[(std::size_t)operation];
+}
+void LatencyTracing::Record(const TraceEvent& event) {
+	if (isHistogramsEnabled.load(std::memory_order_relaxed))
+		histograms[(std::size_t)event.operation][GetSizeClass(event.digitsCount)][LatencyHistogram::GetBucket(event.durationNanoseconds)].fetch_add(1, std::memory_order_relaxed);
+	if (isTracingEnabled.load(std::memory_order_relaxed)) {
+		std::shared_ptr<const std::function<void(const TraceEvent&)>> callback = std::atomic_load(&traceCallback);
+		if (callback)
+			(*callback)(event);
+	}
+}
+
+LatencyScope::LatencyScope(const TracedOperation& inOperation, const std::size_t& inDigitsCount) : operation(inOperation), digitsCount(inDigitsCount) {
+	isActive = LatencyTracing::IsActive();
+	if (isActive)
+		start = std::chrono::steady_clock::now();
+}
+LatencyScope::~LatencyScope() {
+	if (!isActive)
+		return;
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	TraceEvent event;
+	event.operation = operation;
+	event.digitsCount = digitsCount;
+	event.startNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count();
+	event.durationNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+	event.threadId = std::this_thread::get_id();
+	// ошибка обработчика не должна превращаться в std::terminate из деструктора
+	try {
+		LatencyTracing::Record(event);
+	}
+	catch (...) {
+	}
+}
+
+ChromeTraceWriter::ChromeTraceWriter(const std::string& path) : output(path) {
+	if (!output)
+		throw std::runtime_error("ChromeTraceWriter: cannot open " + path);
+	output << "{\"traceEvents\":[";
+	isFirstEvent = true;
+}
+ChromeTraceWriter::~ChromeTraceWriter() {
+	output << "\n]}\n";
+}
+void ChromeTraceWriter::Write(const TraceEvent& event) {
+	// полные события ("ph":"X") с временем в микросекундах, поток - хэш его идентификатора
+	std::size_t threadId = std::hash<std::thread::id>()(event.threadId) % 1000000;
+	std::lock_guard<std::mutex> lock(outputMutex);
+	output << (isFirstEvent ? "\n" : ",\n");
+	isFirstEvent = false;
+	output << "{\"name\":\"" << LatencyTracing::GetOperationName(event.operation) << "\",\"cat\":\"bigint\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId
+		<< ",\"ts\":" << event.startNanoseconds / 1000 << "." << (event.startNanoseconds % 1000) / 100
+		<< ",\"dur\":" << event.durationNanoseconds / 1000 << "." << (event.durationNanoseconds % 1000) / 100
+		<< ",\"args\":{\"digits\":" << event.digitsCount << "}}";
+}
+std::function<void(const TraceEvent&)> ChromeTraceWriter::GetCallback() {
+	return [this](const TraceEvent& event) {
+		Write(event);
+	};
+}
@@ -0,0 +1,131 @@
+#include <ModContext.h>
+
+ModContext::ModContext(const BigInt& inModulus) : modulus(inModulus) {
+	if (modulus <= 1)
+		throw std::invalid_argument("ModContext: modulus must be greater than 1");
+	digitsCount = modulus.reversedNumberAbsoluteValue.size();
+	int lastDigit = modulus.reversedNumberAbsoluteValue[0];
+	isMontgomery = ((lastDigit % 2 != 0) && (lastDigit != 5));
+	if (isMontgomery) {
+		std::vector<int> rDigits(digitsCount + 1, 0);
+		rDigits[digitsCount] = 1;
+		BigInt r(std::move(rDigits), false);
+		modulusNegativeInverse = r - GetInverseModPowerOfTen(modulus, digitsCount);
+		one = r % modulus;
+		rSquared = (one * one) % modulus;
+	}
+	else
+		one = 1;
+}
+const BigInt& ModContext::GetModulus() const {
+	return modulus;
+}
+bool ModContext::IsMontgomery() const {
+	return isMontgomery;
+}
+BigInt ModContext::ToForm(const BigInt& num) const {
+	BigInt residue = num;
+	if ((residue < 0) || (residue >= modulus)) {
+		residue %= modulus;
+		if (residue < 0)
+			residue += modulus;
+	}
+	return (isMontgomery ? Reduce(residue * rSquared) : residue);
+}
+BigInt ModContext::FromForm(const BigInt& num) const {
+	return (isMontgomery ? Reduce(num) : num);
+}
+const BigInt& ModContext::GetOne() const {
+	return one;
+}
+BigInt ModContext::AddMod(const BigInt& summand1, const BigInt& summand2) const {
+	// форма Монтгомери сохраняется при сложении, поэтому сложение одинаково для обоих режимов
+	BigInt sum = summand1 + summand2;
+	if (sum >= modulus)
+		sum -= modulus;
+	return sum;
+}
+BigInt ModContext::SubMod(const BigInt& minuend, const BigInt& subtrahend) const {
+	BigInt difference = minuend - subtrahend;
+	if (difference < 0)
+		difference += modulus;
+	return difference;
+}
+BigInt ModContext::MulMod(const BigInt& multiplier1, const BigInt& multiplier2) const {
+	return Reduce(multiplier1 * multiplier2);
+}
+BigInt ModContext::PowMod(const BigInt& base, const BigInt& exponent) const {
+	if (exponent < 0)
+		throw std::invalid_argument("ModContext: exponent must be non-negative");
+	// степени основания от 0 до 9, затем result = result^10 * base^digit для каждой цифры показателя
+	BigInt basePowers[10];
+	basePowers[0] = one;
+	for (int i = 1; i < 10; ++i)
+		basePowers[i] = MulMod(basePowers[i - 1], base);
+	const std::vector<int>& exponentDigits = exponent.reversedNumberAbsoluteValue;
+	BigInt result = one;
+	for (std::size_t i = exponentDigits.size(); i-- > 0;) {
+		OperationContext::Checkpoint();
+		// x^10 = ((x^2)^2 * x)^2
+		BigInt square = MulMod(result, result);
+		BigInt fifthPower = MulMod(MulMod(square, square), result);
+		result = MulMod(fifthPower, fifthPower);
+		if (exponentDigits[i] != 0)
+			result = MulMod(result, basePowers[exponentDigits[i]]);
+	}
+	return result;
+}
+BigInt ModContext::Inverse(const BigInt& num) const {
+	// обратный ищется к обычному остатку, затем переводится обратно в форму контекста
+	BigInt residue = (isMontgomery ? Reduce(num) : num);
+	BigInt remainder1 = modulus, remainder2 = residue;
+	BigInt coefficient1 = 0, coefficient2 = 1;
+	while (remainder2 != 0) {
+		OperationContext::Checkpoint();
+		BigInt quotient = remainder1 / remainder2;
+		BigInt remainder = remainder1 - quotient * remainder2;
+		remainder1 = remainder2;
+		remainder2 = remainder;
+		BigInt coefficient = coefficient1 - quotient * coefficient2;
+		coefficient1 = coefficient2;
+		coefficient2 = coefficient;
+	}
+	if (remainder1 != 1)
+		throw std::domain_error("ModContext: number is not invertible");
+	if (coefficient1 < 0)
+		coefficient1 += modulus;
+	return (isMontgomery ? ToForm(coefficient1) : coefficient1);
+}
+
+BigInt ModContext::Reduce(const BigInt& num) const {
+	if (!isMontgomery)
+		return num % modulus;
+	// m = (num mod R) * N' mod R, тогда num + m * N делится на R нацело
+	BigInt factor = GetLowDigits(GetLowDigits(num, digitsCount) * modulusNegativeInverse, digitsCount);
+	BigInt result = GetHighDigits(num + factor * modulus, digitsCount);
+	if (result >= modulus)
+		result -= modulus;
+	return result;
+}
+BigInt ModContext::GetLowDigits(const BigInt& num, const std::size_t& count) {
+	return BigInt(BigInt::GetVectorPart(num.reversedNumberAbsoluteValue, 0, count), false);
+}
+BigInt ModContext::GetHighDigits(const BigInt& num, const std::size_t& count) {
+	return BigInt(BigInt::GetVectorPart(num.reversedNumberAbsoluteValue, count, num.reversedNumberAbsoluteValue.size()), false);
+}
+BigInt ModContext::GetInverseModPowerOfTen(const BigInt& num, const std::size_t& count) {
+	// обратные по модулю 10 к 1, 3, 7, 9
+	static const int digitInverses[10] = { 0, 1, 0, 7, 0, 0, 0, 3, 0, 9 };
+	BigInt inverse = digitInverses[num.reversedNumberAbsoluteValue[0]];
+	// если inverse - обратный по модулю 10^p, то inverse * (2 - num * inverse) - обратный по модулю 10^(2p)
+	for (std::size_t precision = 1; precision < count;) {
+		precision = (precision * 2 < count ? precision * 2 : count);
+		BigInt correction = GetLowDigits(num * inverse, precision);
+		std::vector<int> twoDigits(precision + 1, 0);
+		twoDigits[0] = 2;
+		twoDigits[precision] = 1;
+		// 2 - num * inverse по модулю 10^precision, неотрицательное: 10^precision + 2 - correction
+		inverse = GetLowDigits(inverse * (BigInt(std::move(twoDigits), false) - correction), precision);
+	}
+	return inverse;
+}
@@ -0,0 +1,67 @@
+#include <OperationContext.h>
+
+OperationCancelledException::OperationCancelledException(const std::string& reason) : std::runtime_error(reason) {
+}
+
+thread_local OperationContext* OperationContext::current = nullptr;
+thread_local unsigned OperationContext::checkpointsCount = 0;
+thread_local unsigned OperationContext::progressDepth = 0;
+
+OperationContext::OperationContext() : isCancelled(false) {
+	hasDeadline = false;
+}
+void OperationContext::Cancel() {
+	isCancelled.store(true, std::memory_order_relaxed);
+}
+bool OperationContext::IsCancelled() const {
+	return isCancelled.load(std::memory_order_relaxed);
+}
+void OperationContext::SetDeadline(const std::chrono::steady_clock::time_point& inputDeadline) {
+	hasDeadline = true;
+	deadline = inputDeadline;
+}
+void OperationContext::SetProgressCallback(const std::function<void(const double&)>& callback) {
+	progressCallback = callback;
+}
+OperationContext* OperationContext::GetCurrent() {
+	return current;
+}
+void OperationContext::Checkpoint() {
+	OperationContext* context = current;
+	if (context == nullptr)
+		return;
+	if (context->IsCancelled())
+		throw OperationCancelledException("OperationContext: operation cancelled");
+	if (context->hasDeadline && (++checkpointsCount % deadlineCheckPeriod == 0) && (std::chrono::steady_clock::now() >= context->deadline)) {
+		// после истечения срока следующие проверки в других потоках операции сработают сразу
+		context->Cancel();
+		throw OperationCancelledException("OperationContext: deadline exceeded");
+	}
+}
+void OperationContext::ReportProgress(const double& progress) {
+	OperationContext* context = current;
+	if ((context != nullptr) && (progressDepth == 1) && context->progressCallback)
+		context->progressCallback(progress);
+}
+
+OperationScope::OperationScope(OperationContext* context, const bool& isProgressOwner) {
+	previousContext = OperationContext::current;
+	previousProgressDepth = OperationContext::progressDepth;
+	OperationContext::current = context;
+	// вне владельца прогресса любая ProgressScope оказывается вложенной и ничего не сообщает
+	OperationContext::progressDepth = (isProgressOwner ? 0 : 1);
+}
+OperationScope::~OperationScope() {
+	OperationContext::current = previousContext;
+	OperationContext::progressDepth = previousProgressDepth;
+}
+
+ProgressScope::ProgressScope() {
+	isOutermost = (++OperationContext::progressDepth == 1);
+}
+ProgressScope::~ProgressScope() {
+	--OperationContext::progressDepth;
+}
+bool ProgressScope::IsOutermost() const {
+	return isOutermost;
+}
@@ -0,0 +1,45 @@
+#include <ParallelExecution.h>
+
+void ParallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t)>& body, std::size_t minimalChunkSize) {
+	if (begin >= end)
+		return;
+	ThreadPool& pool = ThreadPool::GetShared();
+	std::size_t indexesCount = end - begin;
+	std::size_t threadsCount = pool.GetThreadsCount();
+	if (minimalChunkSize == 0)
+		minimalChunkSize = 1;
+	if (threadsCount > indexesCount / minimalChunkSize)
+		threadsCount = indexesCount / minimalChunkSize;
+	// если работы мало или ядро одно, выполняем в текущем потоке
+	if (threadsCount <= 1) {
+		for (std::size_t i = begin; i < end; ++i)
+			body(i);
+		return;
+	}
+	// индексы раздаются потокам через шаг, чтобы соседние строки матриц и т.п. нагружали потоки равномерно
+	std::vector<std::future<void>> futures;
+	for (std::size_t t = 1; t < threadsCount; ++t)
+		futures.push_back(pool.Submit([&, t]() {
+			for (std::size_t i = begin + t; i < end; i += threadsCount)
+				body(i);
+		}));
+	std::exception_ptr exception;
+	try {
+		for (std::size_t i = begin; i < end; i += threadsCount)
+			body(i);
+	}
+	catch (...) {
+		exception = std::current_exception();
+	}
+	// задачи ссылаются на локальные переменные, поэтому дожидаемся всех, даже если была ошибка
+	for (std::size_t t = 0; t < futures.size(); ++t)
+		try {
+			pool.Wait(futures[t]);
+		}
+		catch (...) {
+			if (!exception)
+				exception = std::current_exception();
+		}
+	if (exception)
+		std::rethrow_exception(exception);
+}
@@ -0,0 +1,77 @@
+#include <ParallelReduction.h>
+
+BigIrreducibleFraction ParallelReduction::GetSum(const std::vector<BigIrreducibleFraction>& fractions) {
+	if (fractions.empty())
+		return BigIrreducibleFraction();
+	return GetTreeResult(fractions.data(), fractions.data() + fractions.size(), true);
+}
+BigIrreducibleFraction ParallelReduction::GetProduct(const std::vector<BigIrreducibleFraction>& fractions) {
+	if (fractions.empty())
+		return BigIrreducibleFraction(1, 1);
+	return GetTreeResult(fractions.data(), fractions.data() + fractions.size(), false);
+}
+
+BigIrreducibleFraction ParallelReduction::GetTreeResult(const BigIrreducibleFraction* begin, const BigIrreducibleFraction* end, const bool& isSum) {
+	if (end - begin == 1)
+		return *begin;
+	const BigIrreducibleFraction* middle = begin + (end - begin) / 2;
+	if (end - begin <= (std::ptrdiff_t)parallelLeafSize)
+		return GetCombined(GetTreeResult(begin, middle, isSum), GetTreeResult(middle, end, isSum), isSum);
+	// левая половина уходит в пул и может быть перехвачена свободным потоком, правая считается в текущем
+	ThreadPool& pool = ThreadPool::GetShared();
+	std::future<BigIrreducibleFraction> leftFuture = pool.Submit([begin, middle, isSum]() { return GetTreeResult(begin, middle, isSum); });
+	BigIrreducibleFraction right;
+	try {
+		right = GetTreeResult(middle, end, isSum);
+	}
+	catch (...) {
+		try {
+			pool.Wait(leftFuture);
+		}
+		catch (...) {
+		}
+		throw;
+	}
+	return GetCombined(pool.Wait(leftFuture), right, isSum);
+}
+BigIrreducibleFraction ParallelReduction::GetCombined(const BigIrreducibleFraction& left, const BigIrreducibleFraction& right, const bool& isSum) {
+	const BigInt& leftNumerator = left.GetNumerator();
+	const BigInt& leftDenominator = left.GetDenominator();
+	const BigInt& rightNumerator = right.GetNumerator();
+	const BigInt& rightDenominator = right.GetDenominator();
+	if (!isSum) {
+		// a/b * c/d: a несократима с b, c - с d, поэтому сокращать нужно только a с d и c с b
+		if ((leftNumerator == 0) || (rightNumerator == 0))
+			return BigIrreducibleFraction();
+		BigInt divisor1 = BigInt::GetGreatestCommonDivisor(leftNumerator, rightDenominator);
+		BigInt divisor2 = BigInt::GetGreatestCommonDivisor(rightNumerator, leftDenominator);
+		return BigIrreducibleFraction::CreateFromReduced((leftNumerator / divisor1) * (rightNumerator / divisor2), (leftDenominator / divisor2) * (rightDenominator / divisor1));
+	}
+	if (leftDenominator == rightDenominator) {
+		// при общем знаменателе (например, для целых) знаменатели не перемножаются
+		BigInt numerator = leftNumerator + rightNumerator;
+		if (numerator == 0)
+			return BigIrreducibleFraction();
+		BigInt divisor = BigInt::GetGreatestCommonDivisor(numerator, leftDenominator);
+		return BigIrreducibleFraction::CreateFromReduced(numerator / divisor, leftDenominator / divisor);
+	}
+	// a/b + c/d при g = НОД(b, d): числитель a(d/g) + c(b/g) может иметь общий множитель со знаменателем только внутри g
+	BigInt denominatorsDivisor = BigInt::GetGreatestCommonDivisor(leftDenominator, rightDenominator);
+	if (denominatorsDivisor == 1) {
+		BigInt numerator = Fuse(leftNumerator) * rightDenominator + Fuse(leftDenominator) * rightNumerator;
+		return BigIrreducibleFraction::CreateFromReduced(numerator, leftDenominator * rightDenominator);
+	}
+	BigInt leftFactor = leftDenominator / denominatorsDivisor, rightFactor = rightDenominator / denominatorsDivisor;
+	BigInt numerator = Fuse(leftNumerator) * rightFactor + Fuse(rightNumerator) * leftFactor;
+	if (numerator == 0)
+		return BigIrreducibleFraction();
+	BigInt divisor = BigInt::GetGreatestCommonDivisor(numerator, denominatorsDivisor);
+	return BigIrreducibleFraction::CreateFromReduced(numerator / divisor, leftFactor * (rightDenominator / divisor));
+}
+
+BigIrreducibleFraction ParallelSum(const std::vector<BigIrreducibleFraction>& fractions) {
+	return ParallelReduction::GetSum(fractions);
+}
+BigIrreducibleFraction ParallelProduct(const std::vector<BigIrreducibleFraction>& fractions) {
+	return ParallelReduction::GetProduct(fractions);
+}
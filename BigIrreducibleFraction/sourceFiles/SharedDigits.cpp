@@ -0,0 +1,101 @@
+#include <SharedDigits.h>
+#include <utility>
+
+SharedDigits::SharedDigits() : buffer(nullptr) {
+}
+SharedDigits::SharedDigits(const std::vector<int>& inputDigits) : buffer(new Buffer(std::vector<int>(inputDigits))) {
+}
+SharedDigits::SharedDigits(std::vector<int>&& inputDigits) : buffer(new Buffer(std::move(inputDigits))) {
+}
+SharedDigits::SharedDigits(const SharedDigits& other) noexcept : buffer(other.buffer) {
+	// новая ссылка появляется от уже существующей, поэтому упорядочивать ее с другими потоками не нужно
+	if (buffer)
+		buffer->referencesCount.fetch_add(1, std::memory_order_relaxed);
+}
+SharedDigits::SharedDigits(SharedDigits&& other) noexcept : buffer(other.buffer) {
+	other.buffer = nullptr;
+}
+SharedDigits::~SharedDigits() {
+	Release();
+}
+SharedDigits& SharedDigits::operator=(const SharedDigits& other) noexcept {
+	if (buffer != other.buffer) {
+		if (other.buffer)
+			other.buffer->referencesCount.fetch_add(1, std::memory_order_relaxed);
+		Release();
+		buffer = other.buffer;
+	}
+	return *this;
+}
+SharedDigits& SharedDigits::operator=(SharedDigits&& other) noexcept {
+	if (this != &other) {
+		Release();
+		buffer = other.buffer;
+		other.buffer = nullptr;
+	}
+	return *this;
+}
+SharedDigits& SharedDigits::operator=(const std::vector<int>& inputDigits) {
+	Buffer* newBuffer = new Buffer(std::vector<int>(inputDigits));
+	Release();
+	buffer = newBuffer;
+	return *this;
+}
+SharedDigits& SharedDigits::operator=(std::vector<int>&& inputDigits) {
+	Buffer* newBuffer = new Buffer(std::move(inputDigits));
+	Release();
+	buffer = newBuffer;
+	return *this;
+}
+SharedDigits::operator const std::vector<int>&() const {
+	return Get();
+}
+const std::vector<int>& SharedDigits::Get() const {
+	static const std::vector<int> emptyDigits;
+	return (buffer ? buffer->digits : emptyDigits);
+}
+std::size_t SharedDigits::size() const {
+	return (buffer ? buffer->digits.size() : 0);
+}
+bool SharedDigits::empty() const {
+	return size() == 0;
+}
+const int& SharedDigits::operator[](const std::size_t& index) const {
+	return buffer->digits[index];
+}
+void SharedDigits::push_back(const int& digit) {
+	GetMutable().push_back(digit);
+}
+void SharedDigits::pop_back() {
+	GetMutable().pop_back();
+}
+void SharedDigits::clear() {
+	// общий буфер не копируется, а просто отпускается
+	if (buffer && !IsUnique()) {
+		Release();
+		buffer = nullptr;
+	}
+	else if (buffer)
+		buffer->digits.clear();
+}
+void SharedDigits::reserve(const std::size_t& size) {
+	GetMutable().reserve(size);
+}
+std::vector<int>& SharedDigits::GetMutable() {
+	if (!buffer)
+		buffer = new Buffer(std::vector<int>());
+	else if (!IsUnique()) {
+		Buffer* newBuffer = new Buffer(std::vector<int>(buffer->digits));
+		Release();
+		buffer = newBuffer;
+	}
+	return buffer->digits;
+}
+bool SharedDigits::IsUnique() const {
+	// acquire соединяется с release в Release других копий: их чтения буфера видны завершенными
+	return buffer->referencesCount.load(std::memory_order_acquire) == 1;
+}
+void SharedDigits::Release() noexcept {
+	if (buffer && (buffer->referencesCount.fetch_sub(1, std::memory_order_acq_rel) == 1))
+		delete buffer;
+}
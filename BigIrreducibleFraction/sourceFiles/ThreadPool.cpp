@@ -0,0 +1,82 @@
+#include <ThreadPool.h>
+
+std::atomic<int> ThreadPool::sharedWorkersCount(-1);
+thread_local ThreadPool* ThreadPool::currentPool = nullptr;
+thread_local std::size_t ThreadPool::currentQueueIndex = 0;
+
+ThreadPool::ThreadPool(const unsigned& workersCount) : pendingTasksCount(0) {
+	isStopping = false;
+	for (unsigned i = 0; i <= workersCount; ++i)
+		queues.emplace_back(new TasksQueue());
+	for (unsigned i = 0; i < workersCount; ++i)
+		workers.emplace_back([this, i]() { RunWorker(i); });
+}
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		isStopping = true;
+	}
+	sleepCondition.notify_all();
+	for (std::size_t i = 0; i < workers.size(); ++i)
+		workers[i].join();
+}
+ThreadPool& ThreadPool::GetShared() {
+	static ThreadPool sharedPool(sharedWorkersCount.load() >= 0 ? sharedWorkersCount.load() : (std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0));
+	return sharedPool;
+}
+void ThreadPool::SetSharedWorkersCount(const unsigned& workersCount) {
+	sharedWorkersCount = workersCount;
+}
+unsigned ThreadPool::GetThreadsCount() const {
+	return workers.size() + 1;
+}
+std::size_t ThreadPool::GetOwnQueueIndex() const {
+	return (currentPool == this ? currentQueueIndex : queues.size() - 1);
+}
+bool ThreadPool::TryRunPendingTask(OperationContext* context) {
+	std::function<void()> task;
+	std::size_t ownQueueIndex = GetOwnQueueIndex();
+	// сначала новейшая задача из своей очереди - обычно это собственная подзадача
+	{
+		TasksQueue& queue = *queues[ownQueueIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		for (std::size_t j = queue.tasks.size(); (!task) && (j > 0); --j)
+			if ((context == nullptr) || (queue.tasks[j - 1].context == context)) {
+				task = std::move(queue.tasks[j - 1].run);
+				queue.tasks.erase(queue.tasks.begin() + (j - 1));
+			}
+	}
+	// иначе перехват старейшей задачи из чужой очереди - обычно это самая крупная задача
+	for (std::size_t i = 1; (!task) && (i < queues.size()); ++i) {
+		TasksQueue& queue = *queues[(ownQueueIndex + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		for (std::size_t j = 0; (!task) && (j < queue.tasks.size()); ++j)
+			if ((context == nullptr) || (queue.tasks[j].context == context)) {
+				task = std::move(queue.tasks[j].run);
+				queue.tasks.erase(queue.tasks.begin() + j);
+			}
+	}
+	if (!task)
+		return false;
+	pendingTasksCount--;
+	task();
+	return true;
+}
+ThreadPool::TaskState ThreadPool::GetCurrentTaskState() {
+	TaskState state = { OperationContext::GetCurrent(), Instrumentation::GetTaskState(), WorkloadRecorder::GetDepth() };
+	return state;
+}
+ThreadPool::TaskScope::TaskScope(const TaskState& state) : operationScope(state.context), instrumentationScope(state.instrumentation), recordingScope(state.recordingDepth) {
+}
+void ThreadPool::RunWorker(const std::size_t& queueIndex) {
+	currentPool = this;
+	currentQueueIndex = queueIndex;
+	while (true) {
+		if (TryRunPendingTask(nullptr))
+			continue;
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		sleepCondition.wait(lock, [this]() { return isStopping || (pendingTasksCount.load() > 0); });
+		if (isStopping && (pendingTasksCount.load() <= 0))
+			return;
+	}
+}
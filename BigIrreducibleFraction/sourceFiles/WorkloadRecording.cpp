@@ -0,0 +1,146 @@
+#include <WorkloadRecording.h>
+#include <BigIntSerialization.h>
+#include <algorithm>
+#include <iterator>
+
+namespace {
+	const char traceMagic[8] = { 'B', 'I', 'F', 'T', 'R', 'A', 'C', 'E' };
+	const unsigned char traceVersion = 1;
+}
+
+std::atomic<bool> WorkloadRecorder::isActive(false);
+std::atomic<unsigned long long> WorkloadRecorder::recordedCount(0);
+std::mutex WorkloadRecorder::outputMutex;
+std::unique_ptr<std::ofstream> WorkloadRecorder::output;
+std::atomic<RecordingMode> WorkloadRecorder::mode(RecordingMode::Sizes);
+thread_local unsigned WorkloadRecorder::depth = 0;
+
+void WorkloadRecorder::Start(const std::string& path, const RecordingMode& inMode) {
+	std::unique_ptr<std::ofstream> newOutput(new std::ofstream(path, std::ios::binary));
+	if (!*newOutput)
+		throw std::runtime_error("WorkloadRecorder: cannot open " + path);
+	newOutput->write(traceMagic, sizeof(traceMagic));
+	newOutput->put((char)traceVersion);
+	newOutput->put((char)inMode);
+	std::lock_guard<std::mutex> lock(outputMutex);
+	output = std::move(newOutput);
+	mode.store(inMode, std::memory_order_relaxed);
+	recordedCount.store(0, std::memory_order_relaxed);
+	isActive.store(true, std::memory_order_relaxed);
+}
+void WorkloadRecorder::Stop() {
+	std::lock_guard<std::mutex> lock(outputMutex);
+	isActive.store(false, std::memory_order_relaxed);
+	output.reset();
+}
+bool WorkloadRecorder::IsActive() {
+	return isActive.load(std::memory_order_relaxed);
+}
+unsigned long long WorkloadRecorder::GetRecordedCount() {
+	return recordedCount.load(std::memory_order_relaxed);
+}
+std::size_t WorkloadRecorder::GetOperandsCount(const RecordedOperation& operation) {
+	switch (operation) {
+	case RecordedOperation::FractionSum:
+	case RecordedOperation::FractionDifference:
+	case RecordedOperation::FractionProduct:
+	case RecordedOperation::FractionQuotient:
+	case RecordedOperation::FractionCompare:
+		return 4;
+	default:
+		return 2;
+	}
+}
+const char* WorkloadRecorder::GetOperationName(const RecordedOperation& operation) {
+	static const char* const names[operationsCount] = { "sum", "difference", "product", "quotient", "remainder", "greatest_common_divisor",
+		"fraction_sum", "fraction_difference", "fraction_product", "fraction_quotient", "fraction_compare", "fraction_reduction" };
+	return names[(std::size_t)operation];
+}
+void WorkloadRecorder::Record(const RecordedOperation& operation, const std::initializer_list<std::reference_wrapper<const BigInt>>& operands) {
+	// запись собирается без блокировки, под блокировкой только дописывается в файл
+	RecordingMode currentMode = mode.load(std::memory_order_relaxed);
+	std::string buffer;
+	buffer.push_back((char)operation);
+	for (const BigInt& operand : operands)
+		BigIntSerialization::AppendNumber(buffer, operand, currentMode == RecordingMode::Operands);
+	std::lock_guard<std::mutex> lock(outputMutex);
+	// запись могла быть перезапущена в другом режиме, пока собирался буфер
+	if (!output || (mode.load(std::memory_order_relaxed) != currentMode))
+		return;
+	output->write(buffer.data(), buffer.size());
+	recordedCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+unsigned WorkloadRecorder::GetDepth() {
+	return depth;
+}
+
+WorkloadRecordingScope::WorkloadRecordingScope(const RecordedOperation& operation, const std::initializer_list<std::reference_wrapper<const BigInt>>& operands) {
+	isActive = WorkloadRecorder::IsActive();
+	if (!isActive)
+		return;
+	if (WorkloadRecorder::depth == 0) {
+		// ошибка записи не должна прерывать саму операцию
+		try {
+			WorkloadRecorder::Record(operation, operands);
+		}
+		catch (...) {
+		}
+	}
+	++WorkloadRecorder::depth;
+}
+WorkloadRecordingScope::~WorkloadRecordingScope() {
+	if (isActive)
+		--WorkloadRecorder::depth;
+}
+
+WorkloadRecordingTaskScope::WorkloadRecordingTaskScope(const unsigned& depth) : previousDepth(WorkloadRecorder::depth) {
+	WorkloadRecorder::depth = depth;
+}
+WorkloadRecordingTaskScope::~WorkloadRecordingTaskScope() {
+	WorkloadRecorder::depth = previousDepth;
+}
+
+WorkloadTraceReader::WorkloadTraceReader(const std::string& path) {
+	std::ifstream input(path, std::ios::binary);
+	if (!input)
+		throw std::runtime_error("WorkloadTraceReader: cannot open " + path);
+	contents.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+	if ((contents.size() < sizeof(traceMagic) + 2) || !std::equal(traceMagic, traceMagic + sizeof(traceMagic), contents.data()))
+		throw std::runtime_error("WorkloadTraceReader: " + path + " is not a workload trace");
+	int version = (unsigned char)contents[sizeof(traceMagic)], inputMode = (unsigned char)contents[sizeof(traceMagic) + 1];
+	position = contents.data() + sizeof(traceMagic) + 2;
+	if (version != traceVersion)
+		throw std::runtime_error("WorkloadTraceReader: unsupported trace version " + std::to_string(version));
+	if ((inputMode != (int)RecordingMode::Sizes) && (inputMode != (int)RecordingMode::Operands))
+		throw std::runtime_error("WorkloadTraceReader: unknown recording mode " + std::to_string(inputMode));
+	mode = (RecordingMode)inputMode;
+}
+RecordingMode WorkloadTraceReader::GetMode() const {
+	return mode;
+}
+bool WorkloadTraceReader::Next(RecordedEvent& event) {
+	const char* end = contents.data() + contents.size();
+	if (position == end)
+		return false;
+	int operation = (unsigned char)*position++;
+	if (operation >= (int)WorkloadRecorder::operationsCount)
+		throw std::runtime_error("WorkloadTraceReader: unknown operation code " + std::to_string(operation));
+	event.operation = (RecordedOperation)operation;
+	event.operands.resize(WorkloadRecorder::GetOperandsCount(event.operation));
+	try {
+		// заголовок числа один в обоих режимах, цифры есть только в режиме Operands
+		for (RecordedOperand& operand : event.operands) {
+			unsigned long long header = BigIntSerialization::ReadVarint(position, end);
+			operand.digitsCount = (std::size_t)(header >> 1);
+			operand.isNegative = ((header & 1) != 0);
+			operand.reversedDigits.clear();
+			if ((mode == RecordingMode::Operands) && (operand.digitsCount != 0))
+				operand.reversedDigits = BigIntSerialization::ReadDigits(position, end, operand.digitsCount);
+		}
+	}
+	catch (const std::invalid_argument& exception) {
+		throw std::runtime_error(std::string("WorkloadTraceReader: ") + exception.what());
+	}
+	return true;
+}
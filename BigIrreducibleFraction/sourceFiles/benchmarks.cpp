@@ -0,0 +1,224 @@
+#include <BenchmarkTools.h>
+#include <BigIrreducibleFraction.h>
+#include <ParallelReduction.h>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// набор замеров ядер BigInt и BigIrreducibleFraction, результаты пишутся в JSON
+// запуск: benchmarkSuite [--seed N] [--max-digits N] [--time-budget секунды] [--kernels add,mul,...] [--output файл]
+// размеры операндов идут от 1 до max-digits цифр через 1, 3, 10, 30, ...; входные числа случайные, но повторяемые при одном seed
+// каждый замер повторяет операцию, пока не наберется minMeasureSeconds; размер пропускается (и все большие за ним),
+// если при квадратичном росте от предыдущего замера одна операция заняла бы больше time-budget секунд,
+// поэтому медленные ядра (деление, НОД) не доходят до 10^6 цифр, а в JSON такие размеры отмечены как skipped
+
+namespace {
+	using BenchmarkTools::GetDigitsCounts;
+	using BenchmarkTools::GetRandomNumber;
+	using BenchmarkTools::sink;
+
+	// операция замера: подготовка входных данных размера digitsCount и само действие, которое замеряется
+	struct Kernel {
+		std::string name;
+		std::function<std::function<void()>(const std::size_t& digitsCount, std::mt19937_64& generator)> prepare;
+	};
+
+	struct Measurement {
+		std::string kernel;
+		std::size_t digitsCount;
+		unsigned long long iterations;
+		double nanosecondsPerOperation;
+		bool isSkipped;
+	};
+
+	const double minMeasureSeconds = 0.05;
+	// несократимая дробь a / (a + 1) из digitsCount цифр без подсчета НОД при подготовке
+	BigIrreducibleFraction GetRandomFraction(const std::size_t& digitsCount, std::mt19937_64& generator) {
+		BigInt numerator = GetRandomNumber(digitsCount, generator);
+		return BigIrreducibleFraction::CreateFromReduced(numerator, numerator + 1);
+	}
+	// гармонический ряд 1/1, 1/2, ..., 1/termsCount
+	std::vector<BigIrreducibleFraction> GetHarmonicSeries(const std::size_t& termsCount) {
+		std::vector<BigIrreducibleFraction> series;
+		series.reserve(termsCount);
+		for (std::size_t k = 1; k <= termsCount; ++k)
+			series.push_back(BigIrreducibleFraction::CreateFromReduced(1, BigInt((long long)k)));
+		return series;
+	}
+	std::vector<Kernel> GetKernels() {
+		std::vector<Kernel> kernels;
+		kernels.push_back({ "add", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			BigInt summand1 = GetRandomNumber(digitsCount, generator), summand2 = GetRandomNumber(digitsCount, generator);
+			return std::function<void()>([summand1, summand2]() { sink += (summand1 + summand2 > 0); });
+		} });
+		kernels.push_back({ "mul", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			BigInt multiplier1 = GetRandomNumber(digitsCount, generator), multiplier2 = GetRandomNumber(digitsCount, generator);
+			return std::function<void()>([multiplier1, multiplier2]() { sink += (multiplier1 * multiplier2 > 0); });
+		} });
+		// делимое вдвое длиннее делителя, частное и остаток
+		kernels.push_back({ "divmod", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			BigInt dividend = GetRandomNumber(2 * digitsCount, generator), divisor = GetRandomNumber(digitsCount, generator);
+			return std::function<void()>([dividend, divisor]() {
+				BigInt quotient = dividend / divisor;
+				sink += (dividend - quotient * divisor >= 0);
+			});
+		} });
+		kernels.push_back({ "gcd", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			BigInt num1 = GetRandomNumber(digitsCount, generator), num2 = GetRandomNumber(digitsCount, generator);
+			return std::function<void()>([num1, num2]() { sink += (BigInt::GetGreatestCommonDivisor(num1, num2) > 0); });
+		} });
+		kernels.push_back({ "parse", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			std::ostringstream stream;
+			stream << GetRandomNumber(digitsCount, generator);
+			std::string digits = stream.str();
+			return std::function<void()>([digits]() { sink += (BigInt(digits) > 0); });
+		} });
+		kernels.push_back({ "print", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			BigInt num = GetRandomNumber(digitsCount, generator);
+			return std::function<void()>([num]() {
+				std::ostringstream stream;
+				stream << num;
+				sink += stream.str().length();
+			});
+		} });
+		kernels.push_back({ "fraction_add", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			BigIrreducibleFraction summand1 = GetRandomFraction(digitsCount, generator), summand2 = GetRandomFraction(digitsCount, generator);
+			return std::function<void()>([summand1, summand2]() { sink += ((summand1 + summand2).GetDenominator() > 0); });
+		} });
+		kernels.push_back({ "fraction_mul", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			BigIrreducibleFraction multiplier1 = GetRandomFraction(digitsCount, generator), multiplier2 = GetRandomFraction(digitsCount, generator);
+			return std::function<void()>([multiplier1, multiplier2]() { sink += ((multiplier1 * multiplier2).GetDenominator() > 0); });
+		} });
+		kernels.push_back({ "fraction_compare", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			BigIrreducibleFraction num1 = GetRandomFraction(digitsCount, generator), num2 = GetRandomFraction(digitsCount, generator);
+			return std::function<void()>([num1, num2]() { sink += (num1 < num2); });
+		} });
+		// сокращение дроби a*c / (b*c), где a, b и c - по digitsCount / 2 цифр
+		kernels.push_back({ "fraction_reduce", [](const std::size_t& digitsCount, std::mt19937_64& generator) {
+			std::size_t halfDigitsCount = (digitsCount > 1 ? digitsCount / 2 : 1);
+			BigInt factor = GetRandomNumber(halfDigitsCount, generator);
+			BigInt numerator = GetRandomNumber(halfDigitsCount, generator) * factor, denominator = GetRandomNumber(halfDigitsCount, generator) * factor;
+			return std::function<void()>([numerator, denominator]() { sink += (BigIrreducibleFraction(numerator, denominator).GetDenominator() > 0); });
+		} });
+		// сумма ряда 1/1 + 1/2 + ... + 1/n, где n = digitsCount: знаменатели имеют общие множители,
+		// поэтому видно, что дерево ParallelSum с несократимыми промежуточными дробями не медленнее последовательного +=
+		kernels.push_back({ "series_sum_serial", [](const std::size_t& digitsCount, std::mt19937_64&) {
+			std::vector<BigIrreducibleFraction> series = GetHarmonicSeries(digitsCount);
+			return std::function<void()>([series]() {
+				BigIrreducibleFraction sum;
+				for (const BigIrreducibleFraction& term : series)
+					sum += term;
+				sink += (sum.GetDenominator() > 0);
+			});
+		} });
+		kernels.push_back({ "series_sum_parallel", [](const std::size_t& digitsCount, std::mt19937_64&) {
+			std::vector<BigIrreducibleFraction> series = GetHarmonicSeries(digitsCount);
+			return std::function<void()>([series]() { sink += (ParallelSum(series).GetDenominator() > 0); });
+		} });
+		return kernels;
+	}
+
+	Measurement Measure(const Kernel& kernel, const std::size_t& digitsCount, const unsigned long long& seed) {
+		// входные данные зависят только от seed, ядра и размера, поэтому замеры повторяемы и сравнимы между версиями
+		std::seed_seq seedSequence = { (unsigned long long)seed, (unsigned long long)digitsCount, (unsigned long long)std::hash<std::string>()(kernel.name) };
+		std::mt19937_64 generator(seedSequence);
+		std::function<void()> operation = kernel.prepare(digitsCount, generator);
+		Measurement measurement = { kernel.name, digitsCount, 0, 0, false };
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		double elapsedSeconds = 0;
+		do {
+			operation();
+			++measurement.iterations;
+			elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		} while (elapsedSeconds < minMeasureSeconds);
+		measurement.nanosecondsPerOperation = elapsedSeconds * 1e9 / measurement.iterations;
+		return measurement;
+	}
+
+	void WriteJson(std::ostream& os, const std::vector<Measurement>& measurements, const unsigned long long& seed, const std::size_t& maxDigitsCount, const double& timeBudgetSeconds) {
+		os << "{\n";
+		os << "  \"seed\": " << seed << ",\n";
+		os << "  \"maxDigits\": " << maxDigitsCount << ",\n";
+		os << "  \"timeBudgetSeconds\": " << timeBudgetSeconds << ",\n";
+		os << "  \"buildType\": \"" << BENCHMARK_BUILD_TYPE << "\",\n";
+		os << "  \"results\": [";
+		for (std::size_t i = 0; i < measurements.size(); ++i) {
+			const Measurement& measurement = measurements[i];
+			os << (i == 0 ? "\n" : ",\n") << "    { \"kernel\": \"" << measurement.kernel << "\", \"digits\": " << measurement.digitsCount;
+			if (measurement.isSkipped)
+				os << ", \"skipped\": true }";
+			else
+				os << ", \"iterations\": " << measurement.iterations << ", \"nanosecondsPerOperation\": " << measurement.nanosecondsPerOperation << " }";
+		}
+		os << "\n  ]\n}\n";
+	}
+
+	bool IsSelected(const std::string& kernelsList, const std::string& name) {
+		if (kernelsList.empty())
+			return true;
+		std::string list = "," + kernelsList + ",";
+		return list.find("," + name + ",") != std::string::npos;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	unsigned long long seed = 1;
+	std::size_t maxDigitsCount = 1000000;
+	double timeBudgetSeconds = 1;
+	std::string kernelsList, outputPath;
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+		if (i + 1 == argc) {
+			std::cerr << "benchmarkSuite: missing value for " << argument << "\n";
+			return 1;
+		}
+		std::string value = argv[++i];
+		if (argument == "--seed")
+			seed = std::strtoull(value.c_str(), nullptr, 10);
+		else if (argument == "--max-digits")
+			maxDigitsCount = std::strtoull(value.c_str(), nullptr, 10);
+		else if (argument == "--time-budget")
+			timeBudgetSeconds = std::strtod(value.c_str(), nullptr);
+		else if (argument == "--kernels")
+			kernelsList = value;
+		else if (argument == "--output")
+			outputPath = value;
+		else {
+			std::cerr << "benchmarkSuite: unknown option " << argument << "\n";
+			return 1;
+		}
+	}
+	std::vector<Measurement> measurements;
+	std::vector<std::size_t> digitsCounts = GetDigitsCounts(maxDigitsCount);
+	for (const Kernel& kernel : GetKernels()) {
+		if (!IsSelected(kernelsList, kernel.name))
+			continue;
+		bool isOverBudget = false;
+		for (std::size_t i = 0; i < digitsCounts.size(); ++i) {
+			if (isOverBudget) {
+				measurements.push_back({ kernel.name, digitsCounts[i], 0, 0, true });
+				continue;
+			}
+			Measurement measurement = Measure(kernel, digitsCounts[i], seed);
+			measurements.push_back(measurement);
+			std::cerr << kernel.name << " " << digitsCounts[i] << ": " << measurement.nanosecondsPerOperation << " ns\n";
+			if (i + 1 < digitsCounts.size()) {
+				double growth = (double)digitsCounts[i + 1] / digitsCounts[i];
+				isOverBudget = (measurement.nanosecondsPerOperation * growth * growth > timeBudgetSeconds * 1e9);
+			}
+		}
+	}
+	if (outputPath.empty())
+		WriteJson(std::cout, measurements, seed, maxDigitsCount, timeBudgetSeconds);
+	else {
+		std::ofstream output(outputPath);
+		WriteJson(output, measurements, seed, maxDigitsCount, timeBudgetSeconds);
+	}
+	return 0;
+}
@@ -1,23 +1,168 @@
 #include <BigIrreducibleFraction.h>
+#include <ExpressionEvaluator.h>
+#include <LatencyTracing.h>
+#include <OperationContext.h>
+#include <ThreadPool.h>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <string>
 
-int main() {
-	BigIrreducibleFraction num1; // num1 = 0 / 1
-	num1 = "-2/7"; // num1 = 2 / 7
-	BigIrreducibleFraction num2(4, 9); // num2 = 4 / 9
-	BigIrreducibleFraction result = num1 + num2; // result = 46 / 63
-	result = num1 - num2; // result = - 10 / 63
-	result = num1 * num2; // result = 8 / 63
-	result = num1 / num2; // result = 9 / 14
-	num1 += num2; // num1 = 46 / 63;
-	num1 -= num2; // num1 = 2 / 7
-	num1 *= num2; // num1 = 8 / 63
-	num1 /= num2; // num1 = 2 / 7
-	result = num1++; // result = 2 / 7, num1 = 9 / 7
-	result = ++num1; // result = 16 / 7, num1 = 16 / 7
-	result = num1--; // result = 16 / 7, num1 = 9 / 7
-	result = --num1; // result = 2 / 7, num1 = 2 / 7
-	result = +num1; // result = 2 / 7
-	result = -num1; // result = - 2 / 7
-	std::cout << "num1: " << num1 << ", num2: " << num2 << ", result: " << result;
-	return 0;
+// потоковый вычислитель рациональных выражений: по одному выражению на строке из файла или стандартного ввода
+// запуск: mainDemonstration [--input файл] [--syntax infix|rpn] [--workers N] [--window N] [--timeout секунды] [--demo]
+// срок одного выражения по умолчанию 10 секунд (--timeout 0 - без срока)
+// запись выражений описана у ExpressionSyntax; выражения вычисляются в общем пуле потоков,
+// одновременно в работе не больше window строк, поэтому память ограничена при любой длине ввода
+// на каждую строку ввода печатается одна строка в том же порядке: дробь p/q или "error: ...",
+// для пустой строки и комментария (строки, начинающейся с '#') - пустая строка
+// результат печатается, когда окно заполнено или результат уже готов, поэтому для работы вручную нужен --window 1
+// в конце в stderr пишутся количество выражений и ошибок, выражений и мегабайт ввода в секунду и задержки одного выражения
+// (p50/p99/max - верхние границы логарифмических корзин); при ошибке в любом выражении код возврата 1
+// --demo вместо вычисления показывает операторы дроби на примерах
+
+namespace {
+	struct LineResult {
+		std::string text;
+		bool isExpression;
+		bool isError;
+		unsigned long long nanoseconds;
+	};
+
+	void RunDemonstration() {
+		BigIrreducibleFraction num1; // num1 = 0 / 1
+		num1 = "-2/7"; // num1 = 2 / 7
+		BigIrreducibleFraction num2(4, 9); // num2 = 4 / 9
+		BigIrreducibleFraction result = num1 + num2; // result = 46 / 63
+		result = num1 - num2; // result = - 10 / 63
+		result = num1 * num2; // result = 8 / 63
+		result = num1 / num2; // result = 9 / 14
+		num1 += num2; // num1 = 46 / 63;
+		num1 -= num2; // num1 = 2 / 7
+		num1 *= num2; // num1 = 8 / 63
+		num1 /= num2; // num1 = 2 / 7
+		result = num1++; // result = 2 / 7, num1 = 9 / 7
+		result = ++num1; // result = 16 / 7, num1 = 16 / 7
+		result = num1--; // result = 16 / 7, num1 = 9 / 7
+		result = --num1; // result = 2 / 7, num1 = 2 / 7
+		result = +num1; // result = 2 / 7
+		result = -num1; // result = - 2 / 7
+		std::cout << "num1: " << num1 << ", num2: " << num2 << ", result: " << result;
+	}
+
+	LineResult EvaluateLine(const std::string& line, const ExpressionSyntax& syntax, const double& timeoutSeconds) {
+		LineResult result = { "", false, false, 0 };
+		std::size_t first = line.find_first_not_of(" \t\r");
+		if ((first == std::string::npos) || (line[first] == '#'))
+			return result;
+		result.isExpression = true;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		// срок выполнения проверяется самими вычислениями BigInt через OperationContext
+		OperationContext context;
+		if (timeoutSeconds > 0)
+			context.SetDeadline(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeoutSeconds)));
+		try {
+			OperationScope scope(&context, true);
+			std::ostringstream stream;
+			stream << ExpressionEvaluator::Evaluate(line, syntax);
+			result.text = stream.str();
+		}
+		catch (const OperationCancelledException&) {
+			result.text = "error: timeout";
+			result.isError = true;
+		}
+		catch (const std::exception& exception) {
+			result.text = std::string("error: ") + exception.what();
+			result.isError = true;
+		}
+		result.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		return result;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	std::string inputPath, syntaxName = "infix";
+	std::size_t windowSize = 0;
+	double timeoutSeconds = 10;
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+		if (argument == "--demo") {
+			RunDemonstration();
+			return 0;
+		}
+		if (i + 1 == argc) {
+			std::cerr << "mainDemonstration: missing value for " << argument << "\n";
+			return 1;
+		}
+		std::string value = argv[++i];
+		if (argument == "--input")
+			inputPath = value;
+		else if (argument == "--syntax")
+			syntaxName = value;
+		else if (argument == "--workers")
+			ThreadPool::SetSharedWorkersCount((unsigned)std::strtoul(value.c_str(), nullptr, 10));
+		else if (argument == "--window")
+			windowSize = std::strtoull(value.c_str(), nullptr, 10);
+		else if (argument == "--timeout")
+			timeoutSeconds = std::strtod(value.c_str(), nullptr);
+		else {
+			std::cerr << "mainDemonstration: unknown option " << argument << "\n";
+			return 1;
+		}
+	}
+	if ((syntaxName != "infix") && (syntaxName != "rpn")) {
+		std::cerr << "mainDemonstration: unknown syntax " << syntaxName << "\n";
+		return 1;
+	}
+	ExpressionSyntax syntax = (syntaxName == "rpn" ? ExpressionSyntax::ReversePolish : ExpressionSyntax::Infix);
+	std::ifstream file;
+	if (!inputPath.empty()) {
+		file.open(inputPath);
+		if (!file) {
+			std::cerr << "mainDemonstration: cannot open " << inputPath << "\n";
+			return 1;
+		}
+	}
+	std::istream& input = (inputPath.empty() ? std::cin : file);
+	std::ios::sync_with_stdio(false);
+	ThreadPool& pool = ThreadPool::GetShared();
+	if (windowSize == 0)
+		windowSize = 4 * pool.GetThreadsCount();
+	LatencyHistogram histogram = {};
+	unsigned long long expressionsCount = 0, errorsCount = 0, inputBytes = 0;
+	std::deque<std::future<LineResult>> pending;
+	// печать готовых результатов из начала окна, при isDraining или заполненном окне - с ожиданием
+	auto printResults = [&](const bool& isDraining) {
+		while (!pending.empty() && (isDraining || (pending.size() >= windowSize) || (pending.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready))) {
+			LineResult result = pool.Wait(pending.front());
+			pending.pop_front();
+			std::cout << result.text << '\n';
+			if (result.isExpression) {
+				++expressionsCount;
+				errorsCount += (result.isError ? 1 : 0);
+				histogram.Add(result.nanoseconds);
+			}
+		}
+		if (pending.empty())
+			std::cout.flush();
+	};
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::string line;
+	while (std::getline(input, line)) {
+		inputBytes += line.size() + 1;
+		pending.push_back(pool.Submit([line, syntax, timeoutSeconds]() {
+			return EvaluateLine(line, syntax, timeoutSeconds);
+		}));
+		printResults(false);
+	}
+	printResults(true);
+	double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cerr << "mainDemonstration: " << expressionsCount << " expressions, " << errorsCount << " errors in " << elapsedSeconds << " s: "
+		<< (elapsedSeconds > 0 ? expressionsCount / elapsedSeconds : 0) << " expressions/s, "
+		<< (elapsedSeconds > 0 ? inputBytes / elapsedSeconds / 1e6 : 0) << " MB/s; latency p50 <= " << histogram.GetQuantileUpperBound(0.5)
+		<< " ns, p99 <= " << histogram.GetQuantileUpperBound(0.99) << " ns, max <= " << histogram.GetQuantileUpperBound(1) << " ns\n";
+	return (errorsCount == 0 ? 0 : 1);
 }
@@ -0,0 +1,238 @@
+#include <BenchmarkTools.h>
+#include <BigIrreducibleFraction.h>
+#include <WorkloadRecording.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// воспроизведение трассы операций, записанной WorkloadRecorder, с замером пропускной способности и задержек
+// запуск: workloadReplay --trace файл [--repeat N] [--seed N] [--output файл]
+// операнды всех записей строятся до замеров; трасса в режиме Sizes получает случайные цифры (повторяемые при одном seed)
+// тех же длин и знаков, поэтому ее можно передавать без исходных данных
+// каждая операция замеряется отдельно, результаты по операциям (количество, ошибки, операций в секунду, задержки p50/p90/p99/max)
+// пишутся в JSON; операция, бросившая исключение (например, деление на ноль, записанное вместе с операндами), считается ошибкой
+
+namespace {
+	using BenchmarkTools::sink;
+
+	// операция трассы с готовыми операндами
+	struct PreparedOperation {
+		RecordedOperation operation;
+		std::vector<BigInt> numbers;
+		std::vector<BigIrreducibleFraction> fractions;
+	};
+
+	struct OperationSummary {
+		std::string operation;
+		unsigned long long count;
+		unsigned long long errorsCount;
+		double totalSeconds;
+		unsigned long long p50Nanoseconds;
+		unsigned long long p90Nanoseconds;
+		unsigned long long p99Nanoseconds;
+		unsigned long long maxNanoseconds;
+	};
+
+	BigInt GetOperand(const RecordedOperand& operand, std::mt19937_64& generator) {
+		if (operand.digitsCount == 0)
+			return BigInt();
+		if (!operand.reversedDigits.empty())
+			return BigInt(operand.reversedDigits, operand.isNegative);
+		BigInt number = BenchmarkTools::GetRandomNumber(operand.digitsCount, generator);
+		return (operand.isNegative ? -number : number);
+	}
+	bool IsFractionOperation(const RecordedOperation& operation) {
+		return (operation >= RecordedOperation::FractionSum) && (operation <= RecordedOperation::FractionCompare);
+	}
+	PreparedOperation Prepare(const RecordedEvent& event, const RecordingMode& mode, std::mt19937_64& generator) {
+		PreparedOperation prepared;
+		prepared.operation = event.operation;
+		for (const RecordedOperand& operand : event.operands)
+			prepared.numbers.push_back(GetOperand(operand, generator));
+		if (IsFractionOperation(event.operation)) {
+			for (std::size_t i = 0; i + 1 < prepared.numbers.size(); i += 2) {
+				BigInt denominator = (prepared.numbers[i + 1] == 0 ? BigInt(1) : prepared.numbers[i + 1]);
+				// записанные дроби уже несократимы, а случайные сокращаются здесь, до замера:
+				// операции над дробями рассчитывают на несократимые операнды
+				if (mode == RecordingMode::Operands)
+					prepared.fractions.push_back(BigIrreducibleFraction::CreateFromReduced(prepared.numbers[i], (denominator < 0 ? -denominator : denominator)));
+				else
+					prepared.fractions.push_back(BigIrreducibleFraction(prepared.numbers[i], denominator));
+			}
+			prepared.numbers.clear();
+		}
+		return prepared;
+	}
+	void Execute(const PreparedOperation& prepared) {
+		const std::vector<BigInt>& numbers = prepared.numbers;
+		const std::vector<BigIrreducibleFraction>& fractions = prepared.fractions;
+		switch (prepared.operation) {
+		case RecordedOperation::Sum:
+			sink += (numbers[0] + numbers[1] > 0);
+			break;
+		case RecordedOperation::Difference:
+			sink += (numbers[0] - numbers[1] > 0);
+			break;
+		case RecordedOperation::Product:
+			sink += (numbers[0] * numbers[1] > 0);
+			break;
+		case RecordedOperation::Quotient:
+			sink += (numbers[0] / numbers[1] > 0);
+			break;
+		case RecordedOperation::Remainder:
+			sink += (numbers[0] % numbers[1] > 0);
+			break;
+		case RecordedOperation::GreatestCommonDivisor:
+			sink += (BigInt::GetGreatestCommonDivisor(numbers[0], numbers[1]) > 0);
+			break;
+		case RecordedOperation::FractionSum:
+			sink += ((fractions[0] + fractions[1]).GetDenominator() > 0);
+			break;
+		case RecordedOperation::FractionDifference:
+			sink += ((fractions[0] - fractions[1]).GetDenominator() > 0);
+			break;
+		case RecordedOperation::FractionProduct:
+			sink += ((fractions[0] * fractions[1]).GetDenominator() > 0);
+			break;
+		case RecordedOperation::FractionQuotient:
+			sink += ((fractions[0] / fractions[1]).GetDenominator() > 0);
+			break;
+		case RecordedOperation::FractionCompare:
+			sink += (fractions[0] < fractions[1]);
+			break;
+		case RecordedOperation::FractionReduction:
+			sink += (BigIrreducibleFraction(numbers[0], numbers[1]).GetDenominator() > 0);
+			break;
+		}
+	}
+
+	// задержка, не больше которой доля quantile отсортированных задержек
+	unsigned long long GetQuantile(const std::vector<unsigned long long>& sortedLatencies, const double& quantile) {
+		if (sortedLatencies.empty())
+			return 0;
+		std::size_t rank = (std::size_t)std::ceil(quantile * sortedLatencies.size());
+		return sortedLatencies[(rank == 0 ? 0 : rank - 1)];
+	}
+	OperationSummary Summarize(const std::string& operation, std::vector<unsigned long long>& latencies, const unsigned long long& errorsCount) {
+		std::sort(latencies.begin(), latencies.end());
+		OperationSummary summary = { operation, latencies.size(), errorsCount, 0, 0, 0, 0, 0 };
+		for (const unsigned long long& latency : latencies)
+			summary.totalSeconds += latency * 1e-9;
+		summary.p50Nanoseconds = GetQuantile(latencies, 0.5);
+		summary.p90Nanoseconds = GetQuantile(latencies, 0.9);
+		summary.p99Nanoseconds = GetQuantile(latencies, 0.99);
+		summary.maxNanoseconds = (latencies.empty() ? 0 : latencies.back());
+		return summary;
+	}
+
+	void WriteSummaryJson(std::ostream& os, const OperationSummary& summary) {
+		os << "{ \"operation\": \"" << summary.operation << "\", \"count\": " << summary.count << ", \"errors\": " << summary.errorsCount
+			<< ", \"operationsPerSecond\": " << (summary.totalSeconds > 0 ? summary.count / summary.totalSeconds : 0)
+			<< ", \"p50Nanoseconds\": " << summary.p50Nanoseconds << ", \"p90Nanoseconds\": " << summary.p90Nanoseconds
+			<< ", \"p99Nanoseconds\": " << summary.p99Nanoseconds << ", \"maxNanoseconds\": " << summary.maxNanoseconds << " }";
+	}
+	void WriteJson(std::ostream& os, const std::string& tracePath, const RecordingMode& mode, const unsigned long long& seed, const unsigned long long& repeatCount,
+		const double& wallSeconds, const OperationSummary& total, const std::vector<OperationSummary>& summaries) {
+		os << "{\n";
+		os << "  \"trace\": \"" << tracePath << "\",\n";
+		os << "  \"mode\": \"" << (mode == RecordingMode::Operands ? "operands" : "sizes") << "\",\n";
+		os << "  \"seed\": " << seed << ",\n";
+		os << "  \"repeat\": " << repeatCount << ",\n";
+		os << "  \"buildType\": \"" << BENCHMARK_BUILD_TYPE << "\",\n";
+		os << "  \"wallSeconds\": " << wallSeconds << ",\n";
+		os << "  \"total\": ";
+		WriteSummaryJson(os, total);
+		os << ",\n  \"results\": [";
+		for (std::size_t i = 0; i < summaries.size(); ++i) {
+			os << (i == 0 ? "\n    " : ",\n    ");
+			WriteSummaryJson(os, summaries[i]);
+		}
+		os << "\n  ]\n}\n";
+	}
+}
+
+int main(int argc, char* argv[]) {
+	unsigned long long seed = 1, repeatCount = 1;
+	std::string tracePath, outputPath;
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+		if (i + 1 == argc) {
+			std::cerr << "workloadReplay: missing value for " << argument << "\n";
+			return 1;
+		}
+		std::string value = argv[++i];
+		if (argument == "--trace")
+			tracePath = value;
+		else if (argument == "--repeat")
+			repeatCount = std::strtoull(value.c_str(), nullptr, 10);
+		else if (argument == "--seed")
+			seed = std::strtoull(value.c_str(), nullptr, 10);
+		else if (argument == "--output")
+			outputPath = value;
+		else {
+			std::cerr << "workloadReplay: unknown option " << argument << "\n";
+			return 1;
+		}
+	}
+	if (tracePath.empty()) {
+		std::cerr << "workloadReplay: --trace is required\n";
+		return 1;
+	}
+	std::vector<PreparedOperation> operations;
+	RecordingMode mode;
+	try {
+		WorkloadTraceReader reader(tracePath);
+		mode = reader.GetMode();
+		std::mt19937_64 generator(seed);
+		RecordedEvent event;
+		while (reader.Next(event))
+			operations.push_back(Prepare(event, mode, generator));
+	}
+	catch (const std::exception& exception) {
+		std::cerr << exception.what() << "\n";
+		return 1;
+	}
+	std::vector<std::vector<unsigned long long>> latencies(WorkloadRecorder::operationsCount);
+	std::vector<unsigned long long> errorsCounts(WorkloadRecorder::operationsCount, 0);
+	std::chrono::steady_clock::time_point wallStart = std::chrono::steady_clock::now();
+	for (unsigned long long repeat = 0; repeat < repeatCount; ++repeat)
+		for (const PreparedOperation& prepared : operations) {
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			try {
+				Execute(prepared);
+			}
+			catch (const std::exception&) {
+				++errorsCounts[(std::size_t)prepared.operation];
+			}
+			std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+			latencies[(std::size_t)prepared.operation].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+		}
+	double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+	std::vector<OperationSummary> summaries;
+	std::vector<unsigned long long> allLatencies;
+	unsigned long long allErrorsCount = 0;
+	for (std::size_t i = 0; i < WorkloadRecorder::operationsCount; ++i) {
+		if (latencies[i].empty())
+			continue;
+		allLatencies.insert(allLatencies.end(), latencies[i].begin(), latencies[i].end());
+		allErrorsCount += errorsCounts[i];
+		summaries.push_back(Summarize(WorkloadRecorder::GetOperationName((RecordedOperation)i), latencies[i], errorsCounts[i]));
+		std::cerr << summaries.back().operation << ": " << summaries.back().count << " operations, p50 " << summaries.back().p50Nanoseconds
+			<< " ns, p99 " << summaries.back().p99Nanoseconds << " ns\n";
+	}
+	OperationSummary total = Summarize("total", allLatencies, allErrorsCount);
+	std::cerr << "total: " << total.count << " operations in " << wallSeconds << " s\n";
+	if (outputPath.empty())
+		WriteJson(std::cout, tracePath, mode, seed, repeatCount, wallSeconds, total, summaries);
+	else {
+		std::ofstream output(outputPath);
+		WriteJson(output, tracePath, mode, seed, repeatCount, wallSeconds, total, summaries);
+	}
+	return 0;
+}
@@ -0,0 +1,456 @@
+#include <FractionClient.h>
+#include <FractionProtocol.h>
+#include <OperationContext.h>
+#include <ThreadPool.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// сервер рациональной арифметики на локальном сокете (протокол FractionProtocol, клиент FractionClient)
+// запуск: fractionServer [--socket путь] [--workers N] [--max-batch N] [--max-result-digits N] [--default-deadline-ms N] [--max-deadline-ms N]
+// [--max-connection-requests N]
+// каждое соединение читает свой поток, запросы всех соединений попадают в общую очередь,
+// из которой пакеты выполнения уходят в общий пул потоков (ThreadPool::GetShared) из workers потоков,
+// в нем же выполняются подзадачи умножения, поэтому лишних потоков нет
+// размер пакета подстраивается под нагрузку: очередь делится поровну между свободными потоками (малые пакеты, малая задержка),
+// когда все потоки заняты, запросы копятся и следующий освободившийся поток забирает до max-batch запросов
+// пакет - право взять до стольких запросов: поток берет их из общей очереди по одному, поэтому запросы, стоящие за медленным,
+// забирают другие потоки, а ответ уходит клиенту сразу после выполнения запроса
+// срок запроса отсчитывается от его получения: просроченный в очереди запрос не выполняется,
+// а во время выполнения срок проверяет OperationContext; запрос без срока получает default-deadline-ms,
+// срок больше max-deadline-ms сокращается до него (0 - без срока по умолчанию и без ограничения)
+// степень, результат которой длиннее max-result-digits цифр, отклоняется (FractionProtocol::SetMaxResultDigitsCount)
+// ответы отправляет свой поток записи соединения из очереди, поэтому клиент, не читающий ответы, не задерживает пул;
+// если очередь ответов соединения превысит maxOutgoingBytes, соединение разрывается
+// у соединения в работе не больше max-connection-requests запросов: пока их больше, следующие кадры из сокета не читаются
+// SIGINT и SIGTERM останавливают сервер: соединения разрываются, принятые запросы доделываются, в stderr пишется статистика
+
+namespace {
+	// наибольший объем неотправленных ответов одного соединения (один больший ответ все равно ставится в очередь)
+	const std::size_t maxOutgoingBytes = 64 << 20;
+
+	// соединение: поток чтения принимает запросы, поток записи отправляет ответы из очереди
+	// сокет закрывается, когда на соединение не остается ссылок (оба потока завершены и все его запросы выполнены)
+	class Connection {
+	public:
+		Connection(const int& inSocket, const std::size_t& inMaxRequestsCount) : socket(inSocket), maxRequestsCount(inMaxRequestsCount),
+			requestsCount(0), outgoingBytes(0), isReadingFinished(false), isBroken(false) {
+		}
+		~Connection() {
+			close(socket);
+		}
+		Connection(const Connection&) = delete;
+		Connection& operator=(const Connection&) = delete;
+		int GetSocket() const {
+			return socket;
+		}
+		bool IsBroken() {
+			std::lock_guard<std::mutex> lock(mutex);
+			return isBroken;
+		}
+		// ожидание, пока запросов в работе станет меньше предела; false - соединение разорвано
+		bool WaitForCapacity() {
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [this]() { return isBroken || (requestsCount < maxRequestsCount); });
+			return !isBroken;
+		}
+		void AddRequests(const std::size_t& count) {
+			std::lock_guard<std::mutex> lock(mutex);
+			requestsCount += count;
+		}
+		// ответ на запрос в очередь записи; при переполнении очереди клиент считается зависшим и соединение разрывается
+		void PushResponse(std::string&& frame) {
+			std::lock_guard<std::mutex> lock(mutex);
+			--requestsCount;
+			if (!isBroken) {
+				if (!outgoingFrames.empty() && (outgoingBytes + frame.size() > maxOutgoingBytes))
+					BreakLocked();
+				else {
+					outgoingBytes += frame.size();
+					outgoingFrames.push_back(std::move(frame));
+				}
+			}
+			condition.notify_all();
+		}
+		// запрос разорванного соединения, снятый без выполнения
+		void DropRequest() {
+			std::lock_guard<std::mutex> lock(mutex);
+			--requestsCount;
+			condition.notify_all();
+		}
+		void FinishReading() {
+			std::lock_guard<std::mutex> lock(mutex);
+			isReadingFinished = true;
+			condition.notify_all();
+		}
+		// разрыв в обе стороны: блокированные чтение и запись завершаются, дальнейшие ответы отбрасываются
+		void Break() {
+			std::lock_guard<std::mutex> lock(mutex);
+			BreakLocked();
+			condition.notify_all();
+		}
+		// поток записи: работает, пока чтение не закончено или остаются неотправленные ответы
+		void RunWriter() {
+			std::unique_lock<std::mutex> lock(mutex);
+			while (true) {
+				condition.wait(lock, [this]() { return isBroken || !outgoingFrames.empty() || (isReadingFinished && (requestsCount == 0)); });
+				if (isBroken || outgoingFrames.empty())
+					return;
+				std::string frame = std::move(outgoingFrames.front());
+				outgoingFrames.pop_front();
+				outgoingBytes -= frame.size();
+				lock.unlock();
+				bool isWritten = FractionSocket::WriteFrame(socket, frame);
+				lock.lock();
+				// клиент мог отключиться, не дождавшись ответа
+				if (!isWritten) {
+					BreakLocked();
+					condition.notify_all();
+					return;
+				}
+			}
+		}
+	private:
+		const int socket;
+		const std::size_t maxRequestsCount;
+		std::mutex mutex;
+		std::condition_variable condition;
+		// принятые, но еще не отвеченные запросы
+		std::size_t requestsCount;
+		std::deque<std::string> outgoingFrames;
+		std::size_t outgoingBytes;
+		bool isReadingFinished;
+		bool isBroken;
+
+		void BreakLocked() {
+			if (isBroken)
+				return;
+			isBroken = true;
+			outgoingFrames.clear();
+			outgoingBytes = 0;
+			shutdown(socket, SHUT_RDWR);
+		}
+	};
+
+	struct PendingRequest {
+		std::shared_ptr<Connection> connection;
+		FractionRequest request;
+		bool hasDeadline;
+		std::chrono::steady_clock::time_point deadline;
+	};
+
+	volatile std::sig_atomic_t isStopRequested = 0;
+
+	void HandleStopSignal(int) {
+		isStopRequested = 1;
+	}
+
+	class RequestDispatcher {
+	public:
+		RequestDispatcher(const unsigned& workersCount, const std::size_t& inMaxBatchSize) : pool(ThreadPool::GetShared()), maxInFlightBatchesCount(workersCount),
+			maxBatchSize(inMaxBatchSize), inFlightBatchesCount(0), startingBatchesCount(0), isStopping(false), requestsCount(0), batchesCount(0), deadlineExceededCount(0) {
+			dispatcherThread = std::thread([this]() { Run(); });
+		}
+		// доделывает принятые запросы
+		~RequestDispatcher() {
+			{
+				std::lock_guard<std::mutex> lock(queueMutex);
+				isStopping = true;
+			}
+			queueCondition.notify_all();
+			dispatcherThread.join();
+		}
+		void Push(std::vector<PendingRequest>& requests) {
+			{
+				std::lock_guard<std::mutex> lock(queueMutex);
+				for (PendingRequest& request : requests)
+					queue.push_back(std::move(request));
+			}
+			queueCondition.notify_all();
+		}
+		void PrintStatistics(std::ostream& os) const {
+			unsigned long long batches = batchesCount.load();
+			os << "fractionServer: " << requestsCount.load() << " requests in " << batches << " batches (average batch "
+				<< (batches == 0 ? 0 : (double)requestsCount.load() / batches) << "), " << deadlineExceededCount.load() << " deadlines exceeded\n";
+		}
+	private:
+		ThreadPool& pool;
+		const unsigned maxInFlightBatchesCount;
+		const std::size_t maxBatchSize;
+		std::mutex queueMutex;
+		std::condition_variable queueCondition;
+		std::deque<PendingRequest> queue;
+		unsigned inFlightBatchesCount;
+		// пакеты, которые еще не взяли первый запрос: для них в очереди уже есть работа, новый пакет не нужен
+		unsigned startingBatchesCount;
+		bool isStopping;
+		std::thread dispatcherThread;
+		std::atomic<unsigned long long> requestsCount;
+		std::atomic<unsigned long long> batchesCount;
+		std::atomic<unsigned long long> deadlineExceededCount;
+
+		void Run() {
+			std::unique_lock<std::mutex> lock(queueMutex);
+			while (true) {
+				queueCondition.wait(lock, [this]() {
+					return ((queue.size() > startingBatchesCount) && (inFlightBatchesCount < maxInFlightBatchesCount)) || (isStopping && queue.empty());
+				});
+				if (queue.empty())
+					break;
+				// очередь делится между свободными потоками, чтобы ни один не простаивал, пока другой выполняет весь пакет
+				std::size_t freeWorkersCount = maxInFlightBatchesCount - inFlightBatchesCount;
+				std::size_t batchSize = std::min((queue.size() - startingBatchesCount + freeWorkersCount - 1) / freeWorkersCount, maxBatchSize);
+				++inFlightBatchesCount;
+				++startingBatchesCount;
+				pool.Submit([this, batchSize]() {
+					RunBatch(batchSize);
+					// оповещение под блокировкой: после уменьшения счетчика диспетчер может быть разрушен
+					std::lock_guard<std::mutex> lock(queueMutex);
+					--inFlightBatchesCount;
+					queueCondition.notify_all();
+				});
+			}
+			// задачи пакетов обращаются к диспетчеру, поэтому выполняющиеся пакеты нужно дождаться
+			queueCondition.wait(lock, [this]() { return inFlightBatchesCount == 0; });
+		}
+		void RunBatch(const std::size_t& batchSize) {
+			std::size_t requestsInBatchCount = 0;
+			for (bool isStarting = true; requestsInBatchCount < batchSize; isStarting = false) {
+				PendingRequest pending;
+				{
+					std::lock_guard<std::mutex> lock(queueMutex);
+					if (isStarting)
+						--startingBatchesCount;
+					if (queue.empty())
+						break;
+					pending = std::move(queue.front());
+					queue.pop_front();
+				}
+				// запрос учитывается до выполнения: статистика печатается, пока последние пакеты могут еще выполняться
+				if (requestsInBatchCount++ == 0)
+					++batchesCount;
+				++requestsCount;
+				if (pending.connection->IsBroken()) {
+					pending.connection->DropRequest();
+					continue;
+				}
+				FractionResponse response;
+				if (pending.hasDeadline && (std::chrono::steady_clock::now() >= pending.deadline))
+					response = { pending.request.id, FractionServiceStatus::DeadlineExceeded, std::vector<BigInt>(), "fractionServer: deadline exceeded in queue" };
+				else {
+					OperationContext context;
+					if (pending.hasDeadline)
+						context.SetDeadline(pending.deadline);
+					OperationScope scope(&context, true);
+					response = FractionProtocol::Execute(pending.request);
+				}
+				if (response.status == FractionServiceStatus::DeadlineExceeded)
+					++deadlineExceededCount;
+				// ответ уходит сразу, чтобы быстрые запросы пакета не ждали медленных; отправляет его поток записи соединения
+				std::string frame;
+				FractionProtocol::AppendResponses(frame, std::vector<FractionResponse>(1, std::move(response)));
+				pending.connection->PushResponse(std::move(frame));
+			}
+		}
+	};
+
+	// потоки чтения и записи соединений и их учет для остановки
+	class ConnectionThreads {
+	public:
+		ConnectionThreads(const unsigned& inDefaultDeadlineMilliseconds, const unsigned& inMaxDeadlineMilliseconds) :
+			defaultDeadlineMilliseconds(inDefaultDeadlineMilliseconds), maxDeadlineMilliseconds(inMaxDeadlineMilliseconds) {
+		}
+		void Start(const std::shared_ptr<Connection>& connection, RequestDispatcher& dispatcher) {
+			std::lock_guard<std::mutex> lock(threadsMutex);
+			connections.erase(std::remove_if(connections.begin(), connections.end(), [](const std::weak_ptr<Connection>& connection) { return connection.expired(); }), connections.end());
+			connections.push_back(connection);
+			activeThreadsCount += 2;
+			std::thread([this, connection, &dispatcher]() {
+				Read(connection, dispatcher, defaultDeadlineMilliseconds, maxDeadlineMilliseconds);
+				FinishThread();
+			}).detach();
+			std::thread([this, connection]() {
+				connection->RunWriter();
+				FinishThread();
+			}).detach();
+		}
+		// разрывает соединения и ждет завершения их потоков
+		void StopAll() {
+			std::unique_lock<std::mutex> lock(threadsMutex);
+			for (const std::weak_ptr<Connection>& weakConnection : connections) {
+				std::shared_ptr<Connection> connection = weakConnection.lock();
+				if (connection)
+					connection->Break();
+			}
+			threadsCondition.wait(lock, [this]() { return activeThreadsCount == 0; });
+		}
+	private:
+		std::mutex threadsMutex;
+		std::condition_variable threadsCondition;
+		std::vector<std::weak_ptr<Connection>> connections;
+		unsigned activeThreadsCount = 0;
+		// срок запроса без срока и наибольший срок (0 - без срока по умолчанию и без ограничения)
+		const unsigned defaultDeadlineMilliseconds;
+		const unsigned maxDeadlineMilliseconds;
+
+		void FinishThread() {
+			std::lock_guard<std::mutex> lock(threadsMutex);
+			--activeThreadsCount;
+			threadsCondition.notify_all();
+		}
+		static void Read(const std::shared_ptr<Connection>& connection, RequestDispatcher& dispatcher, const unsigned& defaultDeadlineMilliseconds,
+			const unsigned& maxDeadlineMilliseconds) {
+			std::string payload;
+			try {
+				// пока у соединения слишком много запросов в работе, сокет не читается и клиент упирается в буфер сокета
+				while (connection->WaitForCapacity() && FractionSocket::ReadFrame(connection->GetSocket(), payload)) {
+					std::vector<FractionRequest> requests = FractionProtocol::ParseRequests(payload.data(), payload.data() + payload.size());
+					std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+					std::vector<PendingRequest> pendingRequests;
+					pendingRequests.reserve(requests.size());
+					for (FractionRequest& request : requests) {
+						unsigned deadlineMilliseconds = (request.deadlineMilliseconds != 0 ? request.deadlineMilliseconds : defaultDeadlineMilliseconds);
+						if ((maxDeadlineMilliseconds != 0) && ((deadlineMilliseconds == 0) || (deadlineMilliseconds > maxDeadlineMilliseconds)))
+							deadlineMilliseconds = maxDeadlineMilliseconds;
+						bool hasDeadline = (deadlineMilliseconds != 0);
+						std::chrono::steady_clock::time_point deadline = now + std::chrono::milliseconds(deadlineMilliseconds);
+						pendingRequests.push_back({ connection, std::move(request), hasDeadline, deadline });
+					}
+					connection->AddRequests(pendingRequests.size());
+					dispatcher.Push(pendingRequests);
+				}
+			}
+			catch (const std::exception& exception) {
+				// нарушение протокола: соединение закрывается, остальные продолжают работать
+				std::cerr << "fractionServer: " << exception.what() << "\n";
+				connection->Break();
+			}
+			connection->FinishReading();
+		}
+	};
+
+	int Listen(const std::string& path) {
+		sockaddr_un address;
+		std::memset(&address, 0, sizeof(address));
+		if (path.size() >= sizeof(address.sun_path))
+			throw std::runtime_error("socket path is too long: " + path);
+		address.sun_family = AF_UNIX;
+		std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+		int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (listener < 0)
+			throw std::runtime_error("cannot create socket");
+		// сокет, оставшийся от прошлого запуска, мешает bind, поэтому удаляется, но только если это сокет,
+		// к которому нельзя подключиться: другой файл или сокет работающего сервера не трогаются
+		struct stat status;
+		if (lstat(path.c_str(), &status) == 0) {
+			std::string error;
+			if (!S_ISSOCK(status.st_mode))
+				error = path + " exists and is not a socket";
+			else {
+				int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+				if ((probe >= 0) && (connect(probe, (const sockaddr*)&address, sizeof(address)) == 0))
+					error = "another server is listening on " + path;
+				if (probe >= 0)
+					close(probe);
+			}
+			if (!error.empty()) {
+				close(listener);
+				throw std::runtime_error(error);
+			}
+			unlink(path.c_str());
+		}
+		if ((bind(listener, (const sockaddr*)&address, sizeof(address)) != 0) || (listen(listener, 64) != 0)) {
+			close(listener);
+			throw std::runtime_error("cannot listen on " + path + ": " + std::strerror(errno));
+		}
+		return listener;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	std::string socketPath = "/tmp/fractionServer.sock";
+	unsigned workersCount = std::thread::hardware_concurrency();
+	std::size_t maxBatchSize = 256;
+	unsigned defaultDeadlineMilliseconds = 10000, maxDeadlineMilliseconds = 60000;
+	std::size_t maxConnectionRequestsCount = 1024;
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+		if (i + 1 == argc) {
+			std::cerr << "fractionServer: missing value for " << argument << "\n";
+			return 1;
+		}
+		std::string value = argv[++i];
+		if (argument == "--socket")
+			socketPath = value;
+		else if (argument == "--workers")
+			workersCount = (unsigned)std::strtoul(value.c_str(), nullptr, 10);
+		else if (argument == "--max-batch")
+			maxBatchSize = std::strtoull(value.c_str(), nullptr, 10);
+		else if (argument == "--max-result-digits")
+			FractionProtocol::SetMaxResultDigitsCount(std::strtoull(value.c_str(), nullptr, 10));
+		else if (argument == "--default-deadline-ms")
+			defaultDeadlineMilliseconds = (unsigned)std::strtoul(value.c_str(), nullptr, 10);
+		else if (argument == "--max-deadline-ms")
+			maxDeadlineMilliseconds = (unsigned)std::strtoul(value.c_str(), nullptr, 10);
+		else if (argument == "--max-connection-requests")
+			maxConnectionRequestsCount = std::strtoull(value.c_str(), nullptr, 10);
+		else {
+			std::cerr << "fractionServer: unknown option " << argument << "\n";
+			return 1;
+		}
+	}
+	if (workersCount == 0)
+		workersCount = 1;
+	if (maxBatchSize == 0)
+		maxBatchSize = 1;
+	if (maxConnectionRequestsCount == 0)
+		maxConnectionRequestsCount = 1;
+	// пакеты выполняют рабочие потоки общего пула, поток диспетчера задачи не выполняет
+	ThreadPool::SetSharedWorkersCount(workersCount);
+	int listener;
+	try {
+		listener = Listen(socketPath);
+	}
+	catch (const std::exception& exception) {
+		std::cerr << "fractionServer: " << exception.what() << "\n";
+		return 1;
+	}
+	std::signal(SIGPIPE, SIG_IGN);
+	std::signal(SIGINT, HandleStopSignal);
+	std::signal(SIGTERM, HandleStopSignal);
+	std::cerr << "fractionServer: listening on " << socketPath << " with " << workersCount << " workers\n";
+	{
+		RequestDispatcher dispatcher(workersCount, maxBatchSize);
+		ConnectionThreads connections(defaultDeadlineMilliseconds, maxDeadlineMilliseconds);
+		while (!isStopRequested) {
+			// ожидание с таймаутом, чтобы вовремя заметить сигнал остановки
+			pollfd listenerPoll = { listener, POLLIN, 0 };
+			if (poll(&listenerPoll, 1, 200) <= 0)
+				continue;
+			int socket = accept(listener, nullptr, nullptr);
+			if (socket >= 0)
+				connections.Start(std::make_shared<Connection>(socket, maxConnectionRequestsCount), dispatcher);
+		}
+		connections.StopAll();
+		dispatcher.PrintStatistics(std::cerr);
+	}
+	close(listener);
+	unlink(socketPath.c_str());
+	return 0;
+}
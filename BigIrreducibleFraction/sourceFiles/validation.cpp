@@ -0,0 +1,560 @@
+#include <BasicIrreducibleFraction.h>
+#include <BenchmarkTools.h>
+#include <BigIntBatch.h>
+#include <BigIntExpression.h>
+#include <BigIrreducibleFractionBatch.h>
+#include <ModContext.h>
+#include <ParallelReduction.h>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// дифференциальная проверка вариантов алгоритмов BigInt и BigIrreducibleFraction
+// запуск: validationSuite [--seed N] [--max-digits N] [--cases N] [--workers N] [--checks mul,divmod,...] [--output файл]
+// для каждой проверки и размера операндов (1, 3, 10, 30, ... до max-digits) берутся пары граничных чисел (0, ±1, 10^(n-1), ±(10^n - 1))
+// и cases случайных наборов; каждый вариант (школьное умножение, Карацуба, параллельная Карацуба, слитые выражения, наборы,
+// FixedBigInt, Монтгомери, проверка инвариантов) выдает результат строкой, которая сравнивается со строкой первого (эталонного) варианта
+// пороги умножения переключаются перед каждым вариантом, поэтому один и тот же размер проходит все ветви алгоритма
+// время каждого варианта суммируется по размеру, так что один прогон показывает и расхождения, и замедления ядер
+// код возврата 1, если хотя бы один вариант разошелся с эталоном; первые расхождения печатаются в stderr
+
+namespace {
+	using BenchmarkTools::GetDigitsCounts;
+
+	typedef std::vector<BigInt> Operands;
+
+	struct Variant {
+		std::string name;
+		// наибольший размер операндов в цифрах, для которого вариант применим (0 - без ограничения)
+		std::size_t maxDigitsCount;
+		std::function<std::string(const Operands& operands)> run;
+	};
+
+	struct Check {
+		std::string name;
+		std::size_t operandsCount;
+		// наибольший размер операндов для всей проверки (0 - без ограничения), медленные ядра не гоняются на больших числах
+		std::size_t maxDigitsCount;
+		// подходят ли операнды проверке (например, ненулевой делитель), nullptr - подходят любые
+		std::function<bool(const Operands& operands)> isValid;
+		// первый вариант - эталонный
+		std::vector<Variant> variants;
+	};
+
+	struct VariantResult {
+		std::string check;
+		std::string variant;
+		std::size_t digitsCount;
+		unsigned long long casesCount;
+		unsigned long long mismatchesCount;
+		double nanosecondsPerCase;
+	};
+
+	// сколько расхождений на вариант печатается в stderr
+	const unsigned long long printedMismatchesCount = 3;
+	// сколько символов операнда или результата печатается при расхождении
+	const std::size_t printedLength = 200;
+
+	std::string ToString(const BigInt& num) {
+		std::ostringstream stream;
+		stream << num;
+		return stream.str();
+	}
+	std::string ToString(const BigIrreducibleFraction& num) {
+		std::ostringstream stream;
+		stream << num.GetNumerator() << '/' << num.GetDenominator();
+		return stream.str();
+	}
+	template <typename Integer>
+	std::string ToString(const BasicIrreducibleFraction<Integer>& num) {
+		std::ostringstream stream;
+		stream << num;
+		return stream.str();
+	}
+	std::string GetShortened(const std::string& text) {
+		if (text.length() <= printedLength)
+			return text;
+		return text.substr(0, printedLength) + "... (" + std::to_string(text.length()) + " chars)";
+	}
+
+	// 10^exponent
+	BigInt GetPowerOfTen(const std::size_t& exponent) {
+		std::vector<int> digits(exponent + 1, 0);
+		digits[exponent] = 1;
+		return BigInt(std::move(digits), false);
+	}
+	// случайное число из digitsCount цифр со случайным знаком: равномерные цифры или длинные серии девяток и нулей,
+	// на которых чаще всего ошибаются переносы и займы
+	BigInt GetRandomOperand(const std::size_t& digitsCount, std::mt19937_64& generator) {
+		unsigned pattern = generator() % 4;
+		BigInt number;
+		if (pattern >= 2)
+			number = BenchmarkTools::GetRandomNumber(digitsCount, generator);
+		else {
+			std::string digits(digitsCount, (pattern == 0 ? '9' : '0'));
+			for (std::size_t i = 0; i < digitsCount; ++i)
+				if (generator() % 8 == 0)
+					digits[i] = (char)('0' + generator() % 10);
+			digits[0] = (char)('1' + generator() % 9);
+			number = BigInt(digits);
+		}
+		return (generator() % 2 == 0 ? number : -number);
+	}
+	std::vector<BigInt> GetEdgeNumbers(const std::size_t& digitsCount) {
+		BigInt maxNumber = GetPowerOfTen(digitsCount) - 1;
+		return { 0, 1, -1, GetPowerOfTen(digitsCount - 1), maxNumber, -maxNumber };
+	}
+	// наборы операндов одного размера: все пары граничных чисел (четные операнды - первое число пары, нечетные - второе)
+	// и casesCount случайных наборов, повторяемых при одном seed
+	std::vector<Operands> GetOperandsSets(const Check& check, const std::size_t& digitsCount, const unsigned& casesCount, const unsigned long long& seed) {
+		std::vector<Operands> operandsSets;
+		std::vector<BigInt> edgeNumbers = GetEdgeNumbers(digitsCount);
+		for (std::size_t i = 0; i < edgeNumbers.size(); ++i)
+			for (std::size_t j = 0; j < edgeNumbers.size(); ++j) {
+				Operands operands;
+				for (std::size_t k = 0; k < check.operandsCount; ++k)
+					operands.push_back(k % 2 == 0 ? edgeNumbers[i] : edgeNumbers[j]);
+				operandsSets.push_back(operands);
+			}
+		std::seed_seq seedSequence = { (unsigned long long)seed, (unsigned long long)digitsCount, (unsigned long long)std::hash<std::string>()(check.name) };
+		std::mt19937_64 generator(seedSequence);
+		for (unsigned i = 0; i < casesCount; ++i) {
+			Operands operands;
+			for (std::size_t k = 0; k < check.operandsCount; ++k)
+				operands.push_back(GetRandomOperand(digitsCount, generator));
+			operandsSets.push_back(operands);
+		}
+		return operandsSets;
+	}
+
+	// задает настройки умножения BigInt до конца области и затем возвращает прежние,
+	// чтобы эталонные варианты следующих проверок считались с настройками по умолчанию
+	class MultiplicationSettingsScope {
+	public:
+		MultiplicationSettingsScope(const unsigned& threadsCount, const std::size_t& karatsubaThreshold, const std::size_t& parallelThreshold) :
+			previousThreadsCount(BigInt::GetMultiplicationThreadsCount()), previousKaratsubaThreshold(BigInt::GetKaratsubaThreshold()),
+			previousParallelThreshold(BigInt::GetParallelMultiplicationThreshold()) {
+			BigInt::SetMultiplicationThreadsCount(threadsCount);
+			BigInt::SetKaratsubaThreshold(karatsubaThreshold);
+			BigInt::SetParallelMultiplicationThreshold(parallelThreshold);
+		}
+		~MultiplicationSettingsScope() {
+			BigInt::SetMultiplicationThreadsCount(previousThreadsCount);
+			BigInt::SetKaratsubaThreshold(previousKaratsubaThreshold);
+			BigInt::SetParallelMultiplicationThreshold(previousParallelThreshold);
+		}
+		MultiplicationSettingsScope(const MultiplicationSettingsScope&) = delete;
+		MultiplicationSettingsScope& operator=(const MultiplicationSettingsScope&) = delete;
+	private:
+		unsigned previousThreadsCount;
+		std::size_t previousKaratsubaThreshold;
+		std::size_t previousParallelThreshold;
+	};
+
+	// вариант, выполняемый с заданными настройками умножения BigInt
+	std::function<std::string(const Operands&)> WithMultiplication(const unsigned& threadsCount, const std::size_t& karatsubaThreshold, const std::size_t& parallelThreshold, const std::function<std::string(const Operands&)>& run) {
+		return [threadsCount, karatsubaThreshold, parallelThreshold, run](const Operands& operands) {
+			MultiplicationSettingsScope settingsScope(threadsCount, karatsubaThreshold, parallelThreshold);
+			return run(operands);
+		};
+	}
+	// школьное умножение, Карацуба в одном потоке и Карацуба с параллельными подзадачами с самого малого размера
+	std::vector<Variant> GetMultiplicationVariants(const std::function<std::string(const Operands&)>& run) {
+		const std::size_t never = std::numeric_limits<std::size_t>::max();
+		return {
+			{ "schoolbook", 0, WithMultiplication(1, never, never, run) },
+			{ "karatsuba", 0, WithMultiplication(1, 0, never, run) },
+			{ "karatsuba_parallel", 0, WithMultiplication(0, 0, 0, run) }
+		};
+	}
+
+	// делимое a * b + c вдвое длиннее делителя b, а остаток не равен c, если |c| >= |b|
+	BigInt GetDividend(const Operands& operands) {
+		return operands[0] * operands[1] + operands[2];
+	}
+	template <std::size_t Bits>
+	std::string GetFixedQuotientAndRemainder(const Operands& operands) {
+		FixedBigInt<Bits> quotient, remainder;
+		FixedBigInt<Bits>::GetQuotientAndRemainder(FixedBigInt<Bits>(GetDividend(operands)), FixedBigInt<Bits>(operands[1]), quotient, remainder);
+		return quotient.ToString() + " " + remainder.ToString();
+	}
+
+	// результаты четырех действий и сравнения двух дробей одного типа
+	template <typename Fraction>
+	std::string GetFractionResults(const Fraction& fraction1, const Fraction& fraction2) {
+		return ToString(fraction1 + fraction2) + " " + ToString(fraction1 - fraction2) + " " + ToString(fraction1 * fraction2) + " "
+			+ ToString(fraction2 == Fraction() ? Fraction() : fraction1 / fraction2) + " " + std::to_string(fraction1 < fraction2);
+	}
+	BigIrreducibleFraction GetFraction(const Operands& operands, const std::size_t& index) {
+		return BigIrreducibleFraction(operands[index], operands[index + 1]);
+	}
+	// ряд из seriesLength дробей (operands[0] + i) / (|operands[1]| + i + 1), достаточно длинный для параллельной свертки
+	std::vector<BigIrreducibleFraction> GetFractionSeries(const Operands& operands) {
+		const std::size_t seriesLength = 70;
+		BigInt denominator = (operands[1] < 0 ? -operands[1] : operands[1]);
+		std::vector<BigIrreducibleFraction> series;
+		for (std::size_t i = 0; i < seriesLength; ++i)
+			series.push_back(BigIrreducibleFraction(operands[0] + (long long)i, denominator + (long long)(i + 1)));
+		return series;
+	}
+
+	// модули для проверки ModContext: взаимно простой с 10 (умножение Монтгомери) и четный (обычные остатки)
+	std::vector<BigInt> GetModuli(const BigInt& num) {
+		BigInt base = ((num < 0 ? -num : num) + 1) * 10;
+		return { base + 1, base + 2 };
+	}
+	BigInt GetResidue(const BigInt& num, const BigInt& modulus) {
+		BigInt residue = num % modulus;
+		return (residue < 0 ? residue + modulus : residue);
+	}
+	// показатель степени из младших цифр operands[1], чтобы эталонное возведение через % оставалось быстрым
+	BigInt GetExponent(const BigInt& num) {
+		return GetResidue(num, 1000);
+	}
+
+	std::vector<Check> GetChecks() {
+		std::vector<Check> checks;
+		// сложение и вычитание
+		{
+			Check check = { "add", 2, 0, nullptr, {} };
+			check.variants.push_back({ "plain", 0, [](const Operands& operands) { return ToString(operands[0] + operands[1]) + " " + ToString(operands[0] - operands[1]); } });
+			check.variants.push_back({ "negated", 0, [](const Operands& operands) { return ToString(operands[0] - (-operands[1])) + " " + ToString(-(operands[1] - operands[0])); } });
+			check.variants.push_back({ "fused", 0, [](const Operands& operands) { return ToString(BigInt(Fuse(operands[0]) + operands[1])) + " " + ToString(BigInt(Fuse(operands[0]) - operands[1])); } });
+			check.variants.push_back({ "batch", 0, [](const Operands& operands) {
+				BigIntBatch batch1(std::vector<BigInt>{ operands[0], operands[0] }), batch2(std::vector<BigInt>{ operands[1], -operands[1] });
+				BigIntBatch sums = BigIntBatch::GetSum(batch1, batch2);
+				return ToString(sums.Get(0)) + " " + ToString(sums.Get(1));
+			} });
+			check.variants.push_back({ "fixed512", 150, [](const Operands& operands) {
+				FixedBigInt<512> num1(operands[0]), num2(operands[1]);
+				return (num1 + num2).ToString() + " " + (num1 - num2).ToString();
+			} });
+			checks.push_back(check);
+		}
+		// умножение: все ветви BigInt, слитое выражение, наборы и FixedBigInt
+		{
+			Check check = { "mul", 2, 0, nullptr, GetMultiplicationVariants([](const Operands& operands) { return ToString(operands[0] * operands[1]); }) };
+			check.variants.push_back({ "fused", 0, [](const Operands& operands) { return ToString(BigInt(Fuse(operands[0]) * operands[1])); } });
+			check.variants.push_back({ "batch", 0, [](const Operands& operands) {
+				return ToString(BigIntBatch::GetProduct(BigIntBatch(std::vector<BigInt>{ operands[0] }), BigIntBatch(std::vector<BigInt>{ operands[1] })).Get(0));
+			} });
+			check.variants.push_back({ "fixed512", 70, [](const Operands& operands) { return (FixedBigInt<512>(operands[0]) * FixedBigInt<512>(operands[1])).ToString(); } });
+			checks.push_back(check);
+		}
+		// сумма произведений a * b - c * d: по отдельности и одним слитым выражением
+		{
+			Check check = { "sum_of_products", 4, 0, nullptr, GetMultiplicationVariants([](const Operands& operands) { return ToString(operands[0] * operands[1] - operands[2] * operands[3]); }) };
+			check.variants.push_back({ "fused", 0, [](const Operands& operands) { return ToString(BigInt(Fuse(operands[0]) * operands[1] - Fuse(operands[2]) * operands[3])); } });
+			checks.push_back(check);
+		}
+		// деление с остатком, округление к нулю
+		{
+			Check check = { "divmod", 3, 0, [](const Operands& operands) { return operands[1] != 0; }, {} };
+			check.variants.push_back({ "bigint", 0, [](const Operands& operands) {
+				BigInt dividend = GetDividend(operands);
+				return ToString(dividend / operands[1]) + " " + ToString(dividend % operands[1]);
+			} });
+			// n = q * d + r, |r| < |d|, знак r совпадает со знаком n
+			check.variants.push_back({ "invariant", 0, [](const Operands& operands) {
+				BigInt dividend = GetDividend(operands);
+				BigInt quotient = dividend / operands[1];
+				BigInt remainder = dividend - quotient * operands[1];
+				BigInt absoluteRemainder = (remainder < 0 ? -remainder : remainder), absoluteDivisor = (operands[1] < 0 ? -operands[1] : operands[1]);
+				if ((absoluteRemainder >= absoluteDivisor) || ((remainder != 0) && ((remainder < 0) != (dividend < 0))))
+					return std::string("invariant violated");
+				return ToString(quotient) + " " + ToString(remainder);
+			} });
+			check.variants.push_back({ "fixed512", 70, GetFixedQuotientAndRemainder<512> });
+			check.variants.push_back({ "fixed128", 15, GetFixedQuotientAndRemainder<128> });
+			checks.push_back(check);
+		}
+		// наибольший общий делитель
+		{
+			Check check = { "gcd", 2, 100, nullptr, {} };
+			check.variants.push_back({ "euclid", 0, [](const Operands& operands) { return ToString(BigInt::GetGreatestCommonDivisor(operands[0], operands[1])); } });
+			// g делит оба числа, а a / g обратимо по модулю |b / g| (расширенный алгоритм Евклида ModContext)
+			check.variants.push_back({ "invariant", 0, [](const Operands& operands) {
+				BigInt divisor = BigInt::GetGreatestCommonDivisor(operands[0], operands[1]);
+				if (divisor == 0)
+					return std::string((operands[0] == 0) && (operands[1] == 0) ? "0" : "invariant violated");
+				if ((operands[0] % divisor != 0) || (operands[1] % divisor != 0))
+					return std::string("invariant violated");
+				BigInt cofactor = operands[1] / divisor;
+				if (cofactor < 0)
+					cofactor = -cofactor;
+				if (cofactor > 1) {
+					ModContext context(cofactor);
+					try {
+						context.Inverse(context.ToForm(operands[0] / divisor));
+					}
+					catch (const std::domain_error&) {
+						return std::string("invariant violated");
+					}
+				}
+				return ToString(divisor);
+			} });
+			check.variants.push_back({ "fixed512", 150, [](const Operands& operands) { return FixedBigInt<512>::GetGreatestCommonDivisor(FixedBigInt<512>(operands[0]), FixedBigInt<512>(operands[1])).ToString(); } });
+			checks.push_back(check);
+		}
+		// корни степеней 2, 3 и 7 из |a| и проверка на точный квадрат
+		{
+			Check check = { "root", 1, 0, nullptr, {} };
+			check.variants.push_back({ "newton", 0, [](const Operands& operands) {
+				BigInt num = (operands[0] < 0 ? -operands[0] : operands[0]);
+				return ToString(BigInt::GetSquareRoot(num)) + " " + ToString(BigInt::GetRoot(num, 3)) + " " + ToString(BigInt::GetRoot(-num, 7)) + " " + std::to_string(BigInt::IsPerfectSquare(num));
+			} });
+			// r^k <= n < (r + 1)^k, точный квадрат - r^2 == n
+			check.variants.push_back({ "invariant", 0, [](const Operands& operands) {
+				BigInt num = (operands[0] < 0 ? -operands[0] : operands[0]);
+				std::string result;
+				for (unsigned degree : { 2u, 3u, 7u }) {
+					BigInt root = BigInt::GetRoot(num, degree);
+					if ((BigInt::GetPower(root, degree) > num) || (BigInt::GetPower(root + 1, degree) <= num))
+						return std::string("invariant violated");
+					result += ToString(degree == 7 ? -root : root) + " ";
+				}
+				BigInt squareRoot = BigInt::GetRoot(num, 2);
+				return result + std::to_string(squareRoot * squareRoot == num);
+			} });
+			check.variants.push_back({ "perfect_square", 0, [](const Operands& operands) {
+				// квадрат числа должен распознаваться, а квадрат плюс один - нет (кроме 0 + 1 = 1)
+				BigInt square = operands[0] * operands[0];
+				if (!BigInt::IsPerfectSquare(square) || (BigInt::IsPerfectSquare(square + 1) != (square == 0)))
+					return std::string("perfect square test failed");
+				BigInt num = (operands[0] < 0 ? -operands[0] : operands[0]);
+				return ToString(BigInt::GetSquareRoot(num)) + " " + ToString(BigInt::GetRoot(num, 3)) + " " + ToString(BigInt::GetRoot(-num, 7)) + " " + std::to_string(BigInt::IsPerfectSquare(num));
+			} });
+			checks.push_back(check);
+		}
+		// умножение и возведение в степень по модулю: обычные остатки против ModContext (Монтгомери и четный модуль)
+		{
+			Check check = { "modmul", 2, 100, nullptr, {} };
+			check.variants.push_back({ "remainder", 0, [](const Operands& operands) {
+				std::string result;
+				for (const BigInt& modulus : GetModuli(operands[1])) {
+					BigInt num1 = GetResidue(operands[0], modulus), num2 = GetResidue(operands[0] + operands[1], modulus);
+					BigInt power = 1, base = num1;
+					for (BigInt exponent = GetExponent(operands[1]); exponent > 0; exponent /= 2) {
+						if (exponent % 2 != 0)
+							power = (power * base) % modulus;
+						base = (base * base) % modulus;
+					}
+					result += ToString((num1 * num2) % modulus) + " " + ToString(power) + " ";
+				}
+				return result;
+			} });
+			check.variants.push_back({ "mod_context", 0, [](const Operands& operands) {
+				std::string result;
+				for (const BigInt& modulus : GetModuli(operands[1])) {
+					ModContext context(modulus);
+					BigInt num1 = context.ToForm(operands[0]), num2 = context.ToForm(operands[0] + operands[1]);
+					result += ToString(context.FromForm(context.MulMod(num1, num2))) + " " + ToString(context.FromForm(context.PowMod(num1, GetExponent(operands[1])))) + " ";
+				}
+				return result;
+			} });
+			checks.push_back(check);
+		}
+		// четыре действия и сравнение дробей operands[0]/operands[1] и operands[2]/operands[3]
+		{
+			Check check = { "fraction", 4, 30, [](const Operands& operands) { return (operands[1] != 0) && (operands[3] != 0); }, {} };
+			check.variants.push_back({ "big", 0, [](const Operands& operands) { return GetFractionResults(GetFraction(operands, 0), GetFraction(operands, 2)); } });
+			check.variants.push_back({ "basic_bigint", 0, [](const Operands& operands) {
+				return GetFractionResults(BasicIrreducibleFraction<BigInt>(operands[0], operands[1]), BasicIrreducibleFraction<BigInt>(operands[2], operands[3]));
+			} });
+			check.variants.push_back({ "basic_fixed512", 30, [](const Operands& operands) {
+				typedef BasicIrreducibleFraction<FixedBigInt<512>> Fraction;
+				return GetFractionResults(Fraction(FixedBigInt<512>(operands[0]), FixedBigInt<512>(operands[1])), Fraction(FixedBigInt<512>(operands[2]), FixedBigInt<512>(operands[3])));
+			} });
+			// FixedBigInt<256> с переходом на BigIrreducibleFraction при переполнении
+			check.variants.push_back({ "promoted_fixed256", 70, [](const Operands& operands) {
+				typedef BasicIrreducibleFraction<FixedBigInt<256>> Fraction;
+				Fraction fraction1{ FixedBigInt<256>(operands[0]), FixedBigInt<256>(operands[1]) }, fraction2{ FixedBigInt<256>(operands[2]), FixedBigInt<256>(operands[3]) };
+				return ToString(GetWithPromotion(fraction1, fraction2, [](const auto& num1, const auto& num2) { return num1 + num2; })) + " "
+					+ ToString(GetWithPromotion(fraction1, fraction2, [](const auto& num1, const auto& num2) { return num1 - num2; })) + " "
+					+ ToString(GetWithPromotion(fraction1, fraction2, [](const auto& num1, const auto& num2) { return num1 * num2; })) + " "
+					+ ToString(fraction2 == Fraction() ? BigIrreducibleFraction() : GetWithPromotion(fraction1, fraction2, [](const auto& num1, const auto& num2) { return num1 / num2; })) + " "
+					+ std::to_string(fraction1 < fraction2);
+			} });
+			check.variants.push_back({ "batch", 0, [](const Operands& operands) {
+				BigIrreducibleFraction fraction1 = GetFraction(operands, 0), fraction2 = GetFraction(operands, 2);
+				BigIrreducibleFractionBatch batch1(std::vector<BigIrreducibleFraction>{ fraction1, fraction1 }), batch2(std::vector<BigIrreducibleFraction>{ fraction2, -fraction2 });
+				BigIrreducibleFractionBatch sums = BigIrreducibleFractionBatch::GetSum(batch1, batch2);
+				BigIrreducibleFraction inverse = (operands[2] == 0 ? BigIrreducibleFraction() : BigIrreducibleFraction(operands[3], operands[2]));
+				BigIrreducibleFractionBatch products = BigIrreducibleFractionBatch::GetProduct(batch1, BigIrreducibleFractionBatch(std::vector<BigIrreducibleFraction>{ fraction2, inverse }));
+				std::vector<int> compareResults = BigIrreducibleFractionBatch::GetCompareResults(batch1, batch2);
+				return ToString(sums.Get(0)) + " " + ToString(sums.Get(1)) + " " + ToString(products.Get(0)) + " " + ToString(products.Get(1)) + " " + std::to_string(compareResults[0] < 0);
+			} });
+			checks.push_back(check);
+		}
+		// сумма и произведение длинного ряда дробей: последовательно и параллельным деревом
+		{
+			Check check = { "fraction_series", 2, 1, nullptr, {} };
+			check.variants.push_back({ "sequential", 0, [](const Operands& operands) {
+				BigIrreducibleFraction sum, product(1, 1);
+				for (const BigIrreducibleFraction& fraction : GetFractionSeries(operands)) {
+					sum += fraction;
+					product *= fraction;
+				}
+				return ToString(sum) + " " + ToString(product);
+			} });
+			check.variants.push_back({ "parallel", 0, [](const Operands& operands) {
+				std::vector<BigIrreducibleFraction> series = GetFractionSeries(operands);
+				return ToString(ParallelSum(series)) + " " + ToString(ParallelProduct(series));
+			} });
+			check.variants.push_back({ "batch", 0, [](const Operands& operands) {
+				std::vector<BigIrreducibleFraction> series = GetFractionSeries(operands);
+				return ToString(BigIrreducibleFractionBatch(series).GetTotalSum()) + " " + ToString(ParallelProduct(series));
+			} });
+			checks.push_back(check);
+		}
+		// разбор и печать
+		{
+			Check check = { "parse", 1, 0, nullptr, {} };
+			check.variants.push_back({ "stream", 0, [](const Operands& operands) { return ToString(operands[0]); } });
+			check.variants.push_back({ "string", 0, [](const Operands& operands) { return ToString(BigInt(ToString(operands[0]))); } });
+			check.variants.push_back({ "char_range", 0, [](const Operands& operands) {
+				std::string text = ToString(operands[0]);
+				return ToString(BigInt(text.data(), text.data() + text.length()));
+			} });
+			check.variants.push_back({ "fixed512", 150, [](const Operands& operands) { return FixedBigInt<512>(ToString(operands[0])).ToString(); } });
+			checks.push_back(check);
+		}
+		return checks;
+	}
+
+	// исключение варианта - тоже результат, который должен совпасть с эталоном
+	std::string GetResult(const Variant& variant, const Operands& operands) {
+		try {
+			return variant.run(operands);
+		}
+		catch (const std::exception& exception) {
+			return std::string("exception: ") + exception.what();
+		}
+	}
+
+	std::vector<VariantResult> RunCheck(const Check& check, const std::size_t& digitsCount, const unsigned& casesCount, const unsigned long long& seed) {
+		std::vector<VariantResult> results;
+		for (const Variant& variant : check.variants)
+			results.push_back({ check.name, variant.name, digitsCount, 0, 0, 0 });
+		for (const Operands& operands : GetOperandsSets(check, digitsCount, casesCount, seed)) {
+			if (check.isValid && !check.isValid(operands))
+				continue;
+			std::string expected;
+			for (std::size_t i = 0; i < check.variants.size(); ++i) {
+				const Variant& variant = check.variants[i];
+				if ((variant.maxDigitsCount != 0) && (digitsCount > variant.maxDigitsCount))
+					continue;
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				std::string result = GetResult(variant, operands);
+				results[i].nanosecondsPerCase += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+				++results[i].casesCount;
+				if (i == 0) {
+					expected = result;
+					continue;
+				}
+				if (result == expected)
+					continue;
+				if (++results[i].mismatchesCount <= printedMismatchesCount) {
+					std::cerr << "mismatch: " << check.name << " / " << variant.name << ", " << digitsCount << " digits\n";
+					for (std::size_t k = 0; k < operands.size(); ++k)
+						std::cerr << "  operand " << k << ": " << GetShortened(ToString(operands[k])) << "\n";
+					std::cerr << "  " << check.variants[0].name << ": " << GetShortened(expected) << "\n";
+					std::cerr << "  " << variant.name << ": " << GetShortened(result) << "\n";
+				}
+			}
+		}
+		std::vector<VariantResult> measuredResults;
+		for (VariantResult& result : results) {
+			if (result.casesCount == 0)
+				continue;
+			result.nanosecondsPerCase /= result.casesCount;
+			measuredResults.push_back(result);
+		}
+		return measuredResults;
+	}
+
+	void WriteJson(std::ostream& os, const std::vector<VariantResult>& results, const unsigned long long& seed, const std::size_t& maxDigitsCount, const unsigned& casesCount) {
+		os << "{\n";
+		os << "  \"seed\": " << seed << ",\n";
+		os << "  \"maxDigits\": " << maxDigitsCount << ",\n";
+		os << "  \"casesPerSize\": " << casesCount << ",\n";
+		os << "  \"buildType\": \"" << BENCHMARK_BUILD_TYPE << "\",\n";
+		os << "  \"results\": [";
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			const VariantResult& result = results[i];
+			os << (i == 0 ? "\n" : ",\n") << "    { \"check\": \"" << result.check << "\", \"variant\": \"" << result.variant << "\", \"digits\": " << result.digitsCount
+				<< ", \"cases\": " << result.casesCount << ", \"mismatches\": " << result.mismatchesCount << ", \"nanosecondsPerCase\": " << result.nanosecondsPerCase << " }";
+		}
+		os << "\n  ]\n}\n";
+	}
+
+	bool IsSelected(const std::string& checksList, const std::string& name) {
+		if (checksList.empty())
+			return true;
+		std::string list = "," + checksList + ",";
+		return list.find("," + name + ",") != std::string::npos;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	unsigned long long seed = 1;
+	std::size_t maxDigitsCount = 300;
+	unsigned casesCount = 20;
+	// рабочие потоки общего пула: даже на одном ядре параллельные ветви выполняются в других потоках
+	unsigned workersCount = 3;
+	std::string checksList, outputPath;
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+		if (i + 1 == argc) {
+			std::cerr << "validationSuite: missing value for " << argument << "\n";
+			return 1;
+		}
+		std::string value = argv[++i];
+		if (argument == "--seed")
+			seed = std::strtoull(value.c_str(), nullptr, 10);
+		else if (argument == "--max-digits")
+			maxDigitsCount = std::strtoull(value.c_str(), nullptr, 10);
+		else if (argument == "--cases")
+			casesCount = (unsigned)std::strtoul(value.c_str(), nullptr, 10);
+		else if (argument == "--workers")
+			workersCount = (unsigned)std::strtoul(value.c_str(), nullptr, 10);
+		else if (argument == "--checks")
+			checksList = value;
+		else if (argument == "--output")
+			outputPath = value;
+		else {
+			std::cerr << "validationSuite: unknown option " << argument << "\n";
+			return 1;
+		}
+	}
+	ThreadPool::SetSharedWorkersCount(workersCount);
+	std::vector<VariantResult> results;
+	unsigned long long mismatchesCount = 0;
+	for (const Check& check : GetChecks()) {
+		if (!IsSelected(checksList, check.name))
+			continue;
+		for (std::size_t digitsCount : GetDigitsCounts(maxDigitsCount)) {
+			if ((check.maxDigitsCount != 0) && (digitsCount > check.maxDigitsCount))
+				break;
+			for (const VariantResult& result : RunCheck(check, digitsCount, casesCount, seed)) {
+				results.push_back(result);
+				mismatchesCount += result.mismatchesCount;
+				std::cerr << result.check << " " << result.variant << " " << result.digitsCount << ": " << result.mismatchesCount << " mismatches, " << result.nanosecondsPerCase << " ns\n";
+			}
+		}
+	}
+	if (outputPath.empty())
+		WriteJson(std::cout, results, seed, maxDigitsCount, casesCount);
+	else {
+		std::ofstream output(outputPath);
+		WriteJson(output, results, seed, maxDigitsCount, casesCount);
+	}
+	std::cerr << (mismatchesCount == 0 ? "all variants agree" : std::to_string(mismatchesCount) + " mismatches") << "\n";
+	return (mismatchesCount == 0 ? 0 : 1);
+}